@@ -28,6 +28,8 @@ semi ?= 0
 etu ?= 0
 bin ?= 0
 uimg ?= 0
+amp ?= 0
+rtos ?= 0
 
 # These variables are assumed to be set already
 ifndef APP_PROGRAM_NAME1
@@ -58,8 +60,16 @@ endif
 EXCLUDE_SRCS :=
 
 # Get and build a list of source file names from the file system with these locations and pattern
+# For the AMP CPU1 image the application sources are in the core1 folder instead
+ifeq ($(amp),core1)
+SRCS := \
+	$(wildcard $(APP_SRC_PATH1)/core1/*.c)
+else
 SRCS := \
 	$(wildcard $(APP_SRC_PATH1)/*.c) \
+	$(wildcard $(APP_SRC_PATH1)/bench/*.c)
+endif
+SRCS := $(SRCS) \
 	$(wildcard $(APP_SRC_PATH1)/bsp/*.c) \
 	$(wildcard $(APP_SRC_PATH1)/trulib/*.c) \
 	$(wildcard $(APP_SRC_PATH1)/trulib/arm/*.c) \
@@ -67,6 +77,30 @@ SRCS := \
 	$(wildcard $(APP_SRC_PATH1)/CMSIS/Core/Source/*.c) \
 	$(wildcard $(APP_SRC_PATH1)/CMSIS/Device/c5soc/source/*.c)
 	
+# Assembly source files
+ASM_SRCS :=
+
+# Optional FreeRTOS kernel (rtos=freertos), FREERTOS_PATH points to a FreeRTOS-Kernel checkout, preferably relative to this Makefile
+# Its objects go to freertos/ under the output path, not next to the kernel sources
+FREERTOS_SRCS :=
+FREERTOS_ASM_SRCS :=
+ifeq ($(rtos),freertos)
+ifndef FREERTOS_PATH
+$(error FREERTOS_PATH variable is not set, it is required with rtos=freertos)
+endif
+FREERTOS_PATH := $(subst \,/,$(FREERTOS_PATH))
+FREERTOS_SRCS := \
+	$(FREERTOS_PATH)/tasks.c \
+	$(FREERTOS_PATH)/queue.c \
+	$(FREERTOS_PATH)/list.c \
+	$(FREERTOS_PATH)/timers.c \
+	$(FREERTOS_PATH)/event_groups.c \
+	$(FREERTOS_PATH)/portable/GCC/ARM_CA9/port.c \
+	$(FREERTOS_PATH)/portable/MemMang/heap_4.c
+FREERTOS_ASM_SRCS := \
+	$(FREERTOS_PATH)/portable/GCC/ARM_CA9/portASM.S
+endif
+
 # Remove exclude files
 SRCS := $(filter-out $(EXCLUDE_SRCS),$(SRCS))
 
@@ -78,9 +112,16 @@ INCS := \
 	-I$(APP_SRC_PATH1)/CMSIS/Core/Include \
 	-I$(APP_SRC_PATH1)/CMSIS/Core/Include/a-profile \
 	-I$(APP_SRC_PATH1)/CMSIS/Device/c5soc/include
+ifeq ($(rtos),freertos)
+INCS := $(INCS) \
+	-I$(FREERTOS_PATH)/include \
+	-I$(FREERTOS_PATH)/portable/GCC/ARM_CA9
+endif
 
 # The linker script to use
-ifeq ($(etu),1)
+ifeq ($(amp),core1)
+LINKER_SCRIPT := $(APP_SRC_PATH1)/bsp/tru_c5soc_ddr_core1.ld
+else ifeq ($(etu),1)
 LINKER_SCRIPT := $(APP_SRC_PATH1)/bsp/tru_c5soc_ddr.ld
 else
 LINKER_SCRIPT := $(APP_SRC_PATH1)/bsp/tru_c5soc_ddr.ld
@@ -97,6 +138,13 @@ LDFLAGS := -Xlinker --gc-sections --specs=nosys.specs
 CFLAGS_SYMBOL_COMMON := -D_RTE_
 CFLAGS_SYMBOL_DEBUG_SEMI := -DSEMIHOSTING
 CFLAGS_SYMBOL_ETU := -DTRU_EXIT_TO_UBOOT=1
+CFLAGS_SYMBOL_AMP := -DTRU_AMP=1
+CFLAGS_SYMBOL_AMP_CORE1 := -DTRU_AMP_CORE1=1
+CFLAGS_SYMBOL_FREERTOS := -DTRU_FREERTOS=1
+
+# AMP CPU1 image output names (built by a sub-make of this file with amp=core1)
+DBG_AMP_CORE1_BIN := $(APP_OUT_PATH)/Debug_core1/$(APP_PROGRAM_NAME1)_core1.bin
+REL_AMP_CORE1_BIN := $(APP_OUT_PATH)/Release_core1/$(APP_PROGRAM_NAME1)_core1.bin
 
 # ================================
 # Optimization and Debugging flags
@@ -119,6 +167,16 @@ endif
 ifeq ($(etu),1)
 DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_ETU)
 endif
+# Conditional debug compiler flags
+ifeq ($(amp),1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_AMP) -DTRU_AMP_CORE1_BIN=\"$(DBG_AMP_CORE1_BIN)\"
+endif
+ifeq ($(amp),core1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_AMP) $(CFLAGS_SYMBOL_AMP_CORE1)
+endif
+ifeq ($(rtos),freertos)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_FREERTOS)
+endif
 # Common debug compiler flags
 DBG_CFLAGS := $(DBG_CFLAGS) $(INCS)
 
@@ -136,8 +194,10 @@ endif
 ifeq ($(etu),1)
 #DBG_LDFLAGS := $(DBG_LDFLAGS) -nostdlib
 endif
-# Common debug linker flags
-DBG_LDFLAGS := $(DBG_LDFLAGS) -T$(LINKER_SCRIPT)
+# Conditional debug linker flags
+ifeq ($(amp),1)
+DBG_LDFLAGS := $(DBG_LDFLAGS) -Xlinker --defsym=__AMP=1
+endif
 
 # =======================================
 # Create list of compiler flags (Release)
@@ -153,6 +213,16 @@ endif
 ifeq ($(etu),1)
 REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_ETU)
 endif
+# Conditional release compiler flags
+ifeq ($(amp),1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_AMP) -DTRU_AMP_CORE1_BIN=\"$(REL_AMP_CORE1_BIN)\"
+endif
+ifeq ($(amp),core1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_AMP) $(CFLAGS_SYMBOL_AMP_CORE1)
+endif
+ifeq ($(rtos),freertos)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_FREERTOS)
+endif
 # Common release compiler flags
 REL_CFLAGS := $(REL_CFLAGS) $(INCS)
 
@@ -170,34 +240,49 @@ endif
 ifeq ($(etu),1)
 #REL_LDFLAGS := $(REL_LDFLAGS) -nostdlib
 endif
-# Common release linker flags
-REL_LDFLAGS := $(REL_LDFLAGS) -T$(LINKER_SCRIPT)
+# Conditional release linker flags
+ifeq ($(amp),1)
+REL_LDFLAGS := $(REL_LDFLAGS) -Xlinker --defsym=__AMP=1
+endif
 
 # ====================
 # App settings (Debug)
 # ====================
 
+ifeq ($(amp),core1)
+DBG_PATH := $(APP_OUT_PATH)/Debug_core1
+APP_PROGRAM_NAME1 := $(APP_PROGRAM_NAME1)_core1
+else
 DBG_PATH := $(APP_OUT_PATH)/Debug
+endif
 DBG_ELF := $(DBG_PATH)/$(APP_PROGRAM_NAME1).elf
+DBG_LD := $(DBG_PATH)/$(APP_PROGRAM_NAME1).ld
 DBG_CFLAGS_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).cflags.txt
 DBG_ELF_LOAD_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).load.txt
 DBG_ELF_ENTRY_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).entry.txt
 DBG_BIN := $(DBG_PATH)/$(APP_PROGRAM_NAME1).bin
 DBG_UIMG := $(DBG_PATH)/$(APP_PROGRAM_NAME1).uimg
-DBG_OBJS := $(patsubst %.c,$(DBG_PATH)/%.o,$(SRCS))
+DBG_OBJS := $(patsubst %.c,$(DBG_PATH)/%.o,$(SRCS)) $(patsubst %.S,$(DBG_PATH)/%.o,$(ASM_SRCS))
+DBG_OBJS := $(DBG_OBJS) $(patsubst $(FREERTOS_PATH)/%.c,$(DBG_PATH)/freertos/%.o,$(FREERTOS_SRCS)) $(patsubst $(FREERTOS_PATH)/%.S,$(DBG_PATH)/freertos/%.o,$(FREERTOS_ASM_SRCS))
 
 # ======================
 # App settings (Release)
 # ======================
 
+ifeq ($(amp),core1)
+REL_PATH := $(APP_OUT_PATH)/Release_core1
+else
 REL_PATH := $(APP_OUT_PATH)/Release
+endif
 REL_ELF := $(REL_PATH)/$(APP_PROGRAM_NAME1).elf
+REL_LD := $(REL_PATH)/$(APP_PROGRAM_NAME1).ld
 REL_CFLAGS_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).cflags.txt
 REL_ELF_LOAD_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).load.txt
 REL_ELF_ENTRY_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).entry.txt
 REL_BIN := $(REL_PATH)/$(APP_PROGRAM_NAME1).bin
 REL_UIMG := $(REL_PATH)/$(APP_PROGRAM_NAME1).uimg
-REL_OBJS := $(patsubst %.c,$(REL_PATH)/%.o,$(SRCS))
+REL_OBJS := $(patsubst %.c,$(REL_PATH)/%.o,$(SRCS)) $(patsubst %.S,$(REL_PATH)/%.o,$(ASM_SRCS))
+REL_OBJS := $(REL_OBJS) $(patsubst $(FREERTOS_PATH)/%.c,$(REL_PATH)/freertos/%.o,$(FREERTOS_SRCS)) $(patsubst $(FREERTOS_PATH)/%.S,$(REL_PATH)/freertos/%.o,$(FREERTOS_ASM_SRCS))
 
 # ============================
 # Read elf load addr from file
@@ -271,6 +356,8 @@ help:
 	@echo "  etu=1         Elf exit to U-Boot"
 	@echo "  bin=1         Outputs binary from the elf"
 	@echo "  uimg=1        Outputs U-Boot image from the binary"
+	@echo "  amp=1         AMP build, also builds and embeds the CPU1 image from the core1 folder"
+	@echo "  rtos=freertos FreeRTOS build, the FREERTOS_PATH variable points to the FreeRTOS-Kernel sources"
 
 # ===========
 # Clean rules
@@ -280,6 +367,8 @@ help:
 clean_1:
 	@if [ -d "$(DBG_PATH)" ]; then echo rm -rf $(DBG_PATH); rm -rf $(DBG_PATH); fi
 	@if [ -d "$(REL_PATH)" ]; then echo rm -rf $(REL_PATH); rm -rf $(REL_PATH); fi
+	@if [ -d "$(dir $(DBG_AMP_CORE1_BIN))" ]; then echo rm -rf $(dir $(DBG_AMP_CORE1_BIN)); rm -rf $(dir $(DBG_AMP_CORE1_BIN)); fi
+	@if [ -d "$(dir $(REL_AMP_CORE1_BIN))" ]; then echo rm -rf $(dir $(REL_AMP_CORE1_BIN)); rm -rf $(dir $(REL_AMP_CORE1_BIN)); fi
 
 # Clean root folder
 clean: clean_1
@@ -353,6 +442,34 @@ ifneq (,$(filter $(CFLAGS_SYMBOL_ETU),$(DBG_CFLAGS_FILE_TEXT)))
 DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
 endif
 endif
+# Same for the AMP define
+ifeq ($(amp),0)
+ifneq (,$(filter $(CFLAGS_SYMBOL_AMP),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+else
+ifeq (,$(filter $(CFLAGS_SYMBOL_AMP),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+# Same for the FreeRTOS define
+ifeq ($(rtos),freertos)
+ifeq (,$(filter $(CFLAGS_SYMBOL_FREERTOS),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_FREERTOS),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+endif
+
+# For the AMP build, make the CPU1 image first because tru_c5soc_hps_amp.c embeds it
+ifeq ($(amp),1)
+$(DBG_PATH)/$(APP_SRC_PATH1)/trulib/c5soc/tru_c5soc_hps_amp.o: $(DBG_AMP_CORE1_BIN)
+
+$(DBG_AMP_CORE1_BIN): FORCE
+	@$(MAKE) -f Makefile-app1.mk --no-print-directory debug semi=$(semi) bin=1 amp=core1
 endif
 
 # ==============================
@@ -363,10 +480,32 @@ endif
 $(DBG_PATH)/%.o: $(DBG_SRCS_PRE)
 	@mkdir -p $(@D)
 	$(CC) -c $(DBG_CFLAGS) -o $@ $<
+
+# Assemble source files
+$(DBG_PATH)/%.o: $(patsubst %.c,%.S,$(DBG_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(DBG_CFLAGS) -o $@ $<
+
+ifeq ($(rtos),freertos)
+# Compile FreeRTOS kernel source files
+$(DBG_PATH)/freertos/%.o: $(patsubst %.c,$(FREERTOS_PATH)/%.c,$(DBG_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(DBG_CFLAGS) -o $@ $<
+
+# Assemble FreeRTOS kernel source files
+$(DBG_PATH)/freertos/%.o: $(patsubst %.c,$(FREERTOS_PATH)/%.S,$(DBG_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(DBG_CFLAGS) -o $@ $<
+endif
 	
+# Preprocess the linker script for the config options it depends on (e.g. TRU_CFG_OCRAM)
+$(DBG_LD): $(LINKER_SCRIPT) $(APP_SRC_PATH1)/bsp/tru_user_config.h
+	@mkdir -p $(@D)
+	$(CC) -E -P -x c $(filter -D% -I%,$(DBG_CFLAGS)) -o $@ $<
+
 # Link object files
-$(DBG_ELF): $(DBG_OBJS)
-	$(LD) $(DBG_LDFLAGS) $(DBG_OBJS) -o $@
+$(DBG_ELF): $(DBG_OBJS) $(DBG_LD)
+	$(LD) $(DBG_LDFLAGS) -T$(DBG_LD) $(DBG_OBJS) -o $@
 	$(NM) $@ > $@.map
 	$(OD) -d $@ > $@.objdump
 
@@ -392,6 +531,34 @@ ifneq (,$(filter $(CFLAGS_SYMBOL_ETU),$(REL_CFLAGS_FILE_TEXT)))
 REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
 endif
 endif
+# Same for the AMP define
+ifeq ($(amp),0)
+ifneq (,$(filter $(CFLAGS_SYMBOL_AMP),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+else
+ifeq (,$(filter $(CFLAGS_SYMBOL_AMP),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+# Same for the FreeRTOS define
+ifeq ($(rtos),freertos)
+ifeq (,$(filter $(CFLAGS_SYMBOL_FREERTOS),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_FREERTOS),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+endif
+
+# For the AMP build, make the CPU1 image first because tru_c5soc_hps_amp.c embeds it
+ifeq ($(amp),1)
+$(REL_PATH)/$(APP_SRC_PATH1)/trulib/c5soc/tru_c5soc_hps_amp.o: $(REL_AMP_CORE1_BIN)
+
+$(REL_AMP_CORE1_BIN): FORCE
+	@$(MAKE) -f Makefile-app1.mk --no-print-directory release semi=$(semi) bin=1 amp=core1
 endif
 
 # ================================
@@ -403,9 +570,31 @@ $(REL_PATH)/%.o: $(REL_SRCS_PRE)
 	@mkdir -p $(@D)
 	$(CC) -c $(REL_CFLAGS) -o $@ $<
 
+# Assemble source files
+$(REL_PATH)/%.o: $(patsubst %.c,%.S,$(REL_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(REL_CFLAGS) -o $@ $<
+
+ifeq ($(rtos),freertos)
+# Compile FreeRTOS kernel source files
+$(REL_PATH)/freertos/%.o: $(patsubst %.c,$(FREERTOS_PATH)/%.c,$(REL_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(REL_CFLAGS) -o $@ $<
+
+# Assemble FreeRTOS kernel source files
+$(REL_PATH)/freertos/%.o: $(patsubst %.c,$(FREERTOS_PATH)/%.S,$(REL_SRCS_PRE))
+	@mkdir -p $(@D)
+	$(CC) -c $(REL_CFLAGS) -o $@ $<
+endif
+
+# Preprocess the linker script for the config options it depends on (e.g. TRU_CFG_OCRAM)
+$(REL_LD): $(LINKER_SCRIPT) $(APP_SRC_PATH1)/bsp/tru_user_config.h
+	@mkdir -p $(@D)
+	$(CC) -E -P -x c $(filter -D% -I%,$(REL_CFLAGS)) -o $@ $<
+
 # Link object files
-$(REL_ELF): $(REL_OBJS)
-	$(LD) $(REL_LDFLAGS) $(REL_OBJS) -o $@
+$(REL_ELF): $(REL_OBJS) $(REL_LD)
+	$(LD) $(REL_LDFLAGS) -T$(REL_LD) $(REL_OBJS) -o $@
 	$(NM) $@ > $@.map
 	$(OD) -d $@ > $@.objdump
 
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# Symbolizes the samples of the tru_prof sampling profiler (source/trulib/tru_prof.h)
+# against the elf, and prints a flat profile.  Optionally writes a collapsed stack
+# file for flamegraph.pl and the hottest source lines.
+#
+# The samples are the text printed by tru_prof_dump(), captured from the UART or a
+# semihosting file.  Other lines around the dump (log output) are ignored.
+#
+# Usage:
+#   python3 prof-symbolize.py Debug/app.elf prof.txt
+#   python3 prof-symbolize.py Debug/app.elf prof.txt --collapsed prof.folded --lines 20
+#   flamegraph.pl prof.folded > prof.svg
+#
+# Needs the toolchain nm and addr2line (--prefix, default arm-none-eabi-).
+
+import argparse
+import bisect
+import collections
+import subprocess
+import sys
+
+MODES = {
+	0x10: "usr",
+	0x11: "fiq",
+	0x12: "irq",
+	0x13: "svc",
+	0x16: "mon",
+	0x17: "abt",
+	0x1A: "hyp",
+	0x1B: "und",
+	0x1F: "sys",
+}
+
+Sample = collections.namedtuple("Sample", "cpu pc lr cpsr")
+
+def parse_dump(path):
+	samples = []
+	info = []
+	cpu = None
+	in_dump = False
+
+	with open(path, "r", errors="replace") as f:
+		for line in f:
+			line = line.strip()
+			if line == "# tru_prof":
+				in_dump = True
+				continue
+			if not in_dump:
+				continue
+			if line == "end":
+				in_dump = False
+				continue
+			fields = line.split()
+			if len(fields) == 8 and fields[0] == "cpu":
+				cpu = int(fields[1])
+				info.append({"cpu": cpu, "rate": int(fields[3]), "samples": int(fields[5]), "dropped": int(fields[7])})
+			elif len(fields) == 3 and cpu is not None:
+				try:
+					pc, lr, cpsr = (int(x, 16) for x in fields)
+				except ValueError:
+					continue
+				samples.append(Sample(cpu, pc, lr, cpsr))
+
+	return samples, info
+
+class Symbols:
+	def __init__(self, elf, prefix):
+		out = subprocess.run([prefix + "nm", "-n", "-S", "-C", "--defined-only", elf], check=True, capture_output=True, text=True).stdout
+		syms = {}
+		for line in out.splitlines():
+			fields = line.split(None, 3)
+			if len(fields) == 4:
+				addr, size, kind, name = fields
+				size = int(size, 16)
+			elif len(fields) == 3:
+				addr, kind, name = fields
+				size = 0
+			else:
+				continue
+			if kind not in "TtWw" or name.startswith("$"):
+				continue
+			addr = int(addr, 16) & ~1  # Thumb bit
+			if addr not in syms or (size and not syms[addr][1]):
+				syms[addr] = (name, size)
+		self.addrs = sorted(syms)
+		self.syms = [syms[a] for a in self.addrs]
+
+	def lookup(self, addr):
+		addr &= ~1
+		i = bisect.bisect_right(self.addrs, addr) - 1
+		if i < 0:
+			return "[unknown]"
+		name, size = self.syms[i]
+		if size and addr >= self.addrs[i] + size:
+			return "[unknown]"
+		return name
+
+def addr2line(elf, prefix, addrs):
+	if not addrs:
+		return {}
+	out = subprocess.run([prefix + "addr2line", "-e", elf, "-f", "-C"] + ["%x" % a for a in addrs], check=True, capture_output=True, text=True).stdout.splitlines()
+	return {a: (out[2 * i], out[2 * i + 1]) for i, a in enumerate(addrs) if 2 * i + 1 < len(out)}
+
+def main():
+	ap = argparse.ArgumentParser(description="Symbolize tru_prof samples")
+	ap.add_argument("elf")
+	ap.add_argument("samples", help="text captured from tru_prof_dump()")
+	ap.add_argument("--prefix", default="arm-none-eabi-", help="toolchain prefix for nm and addr2line")
+	ap.add_argument("--top", type=int, default=40, help="functions in the flat profile")
+	ap.add_argument("--cpu", type=int, help="only this CPU")
+	ap.add_argument("--collapsed", help="write a collapsed stack file (cpu;mode;caller;function count)")
+	ap.add_argument("--lines", type=int, default=0, help="also print the N hottest source lines")
+	args = ap.parse_args()
+
+	samples, info = parse_dump(args.samples)
+	if args.cpu is not None:
+		samples = [s for s in samples if s.cpu == args.cpu]
+	if not samples:
+		sys.exit("No samples found in " + args.samples)
+
+	syms = Symbols(args.elf, args.prefix)
+	total = len(samples)
+	funcs = collections.Counter()
+	modes = collections.Counter()
+	stacks = collections.Counter()
+	pcs = collections.Counter()
+
+	for s in samples:
+		func = syms.lookup(s.pc)
+		mode = MODES.get(s.cpsr & 0x1F, "?")
+		caller = syms.lookup(s.lr - 1)  # LR points after the call, which may be the last instruction of the caller
+		funcs[func] += 1
+		modes[mode] += 1
+		pcs[s.pc & ~1] += 1
+		frames = ["cpu%d" % s.cpu, mode]
+		if caller != func:
+			frames.append(caller)
+		frames.append(func)
+		stacks[";".join(frames)] += 1
+
+	for i in info:
+		if args.cpu is None or i["cpu"] == args.cpu:
+			print("cpu %d: %d samples at %d Hz, %d dropped" % (i["cpu"], i["samples"], i["rate"], i["dropped"]))
+	print("modes: " + ", ".join("%s %.1f%%" % (m, 100.0 * n / total) for m, n in modes.most_common()))
+	print()
+	print("%8s %7s  %s" % ("samples", "%", "function"))
+	for func, n in funcs.most_common(args.top):
+		print("%8d %6.2f%%  %s" % (n, 100.0 * n / total, func))
+
+	if args.lines:
+		hot = [pc for pc, _ in pcs.most_common(args.lines)]
+		lines = addr2line(args.elf, args.prefix, hot)
+		print()
+		print("%8s %7s  %-10s %s" % ("samples", "%", "pc", "line"))
+		for pc in hot:
+			func, where = lines.get(pc, ("??", "??:0"))
+			print("%8d %6.2f%%  %08x   %s (%s)" % (pcs[pc], 100.0 * pcs[pc] / total, pc, where, func))
+
+	if args.collapsed:
+		with open(args.collapsed, "w") as f:
+			for stack, n in sorted(stacks.items()):
+				f.write("%s %d\n" % (stack, n))
+		print()
+		print("Collapsed stacks written to " + args.collapsed)
+
+if __name__ == "__main__":
+	main()
@@ -32,6 +32,22 @@ typedef void (*IRQHandler_t) (void);
 
 #include "irq_ctrl.h"
 
+// Context-carrying handlers
+// =========================
+// A handler registered with irq_set_ctx_handler() is called with its context
+// pointer, so one driver can serve several controller instances.  The handler
+// and context are packed in one entry that never crosses a cache line, and
+// take precedence over the CMSIS IRQTable handler of the same line.  The
+// per CPU call counts and cycles are in TRU_IRQ_STATS, on in DEBUG builds (see
+// tru_irq_affinity.h).
+
+typedef void (*irq_ctx_handler_t)(void *ctx);
+
+typedef struct{
+	irq_ctx_handler_t handler;
+	void *ctx;
+}__attribute__((aligned(8))) irq_ctx_entry_t;
+
 // Interrupt priority grouping
 // ===========================
 // Interrupt priorities is set by two values, group-priority and sub-priority.
@@ -330,5 +346,9 @@ typedef void (*IRQHandler_t) (void);
 
 void irq_set_group_priority(IRQn_ID_t irqn, uint8_t grp_priority, uint8_t sub_priority);
 void irq_mask(uint8_t mask);
+uint32_t irq_nest_level(void);
+void irq_dispatch_id(IRQn_ID_t irq_id);
+int32_t irq_set_ctx_handler(IRQn_ID_t irqn, irq_ctx_handler_t handler, void *ctx);
+void *irq_get_ctx(IRQn_ID_t irqn);
 
 #endif
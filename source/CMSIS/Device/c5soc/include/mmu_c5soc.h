@@ -86,4 +86,8 @@ static inline void MMU_InvalidateRange(uint32_t *ttb, uint32_t base_address, uin
 	void mmu_create_dma_buffer_table_entries(void);
 #endif
 
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U && defined(TRU_MMU) && TRU_MMU == 1U && USE_L1_AND_L2_TABLE == 0U
+	void mmu_create_ocram_table_entries(void);
+#endif
+
 #endif
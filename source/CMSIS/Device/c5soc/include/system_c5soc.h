@@ -40,6 +40,13 @@ extern uint32_t SystemCoreClock;     /*!< System Clock Frequency (Core Clock)  *
  */
 extern void SystemInit (void);
 
+/**
+  \brief Setup the second core (CPU1).
+
+   Called by CPU1 from Reset_Handler_core1, after CPU0 has released it from reset.
+ */
+extern void SystemInit_core1 (void);
+
 /**
   \brief  Update SystemCoreClock variable.
 
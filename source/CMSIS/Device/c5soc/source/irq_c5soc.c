@@ -22,11 +22,23 @@
 
 #include "irq_c5soc.h"
 #include "c5soc.h"
+#include "arm/tru_cortex_a9.h"
+#include "arm/tru_cortex_a9_tlb.h"
+#include "arm/tru_irq_affinity.h"
+#include "arm/tru_vfp_lazy.h"
 #include <stddef.h>
 
 // Define CMSIS IRQ handler table (see irq_ctrl_gic.h)
 IRQHandler_t IRQTable[IRQ_GIC_LINE_COUNT] = { 0U };
 
+// Context-carrying handler table (see irq_c5soc.h)
+TRU_TLB_LOCK_DATA irq_ctx_entry_t irq_ctx_table[IRQ_GIC_LINE_COUNT];
+
+// Lock the TLB entries of the IRQ handler table and the CMSIS GIC functions called by IRQ_Handler
+TRU_TLB_LOCK_REGION(irq_table, "IRQ table", IRQTable, IRQTable + IRQ_GIC_LINE_COUNT);
+TRU_TLB_LOCK_REGION(irq_get_active, "IRQ_GetActiveIRQ", IRQ_GetActiveIRQ, (const uint8_t *)IRQ_GetActiveIRQ + 4U);
+TRU_TLB_LOCK_REGION(irq_eoi, "IRQ_EndOfInterrupt", IRQ_EndOfInterrupt, (const uint8_t *)IRQ_EndOfInterrupt + 4U);
+
 // Overrride CMSIS default weak prototype (see irq_ctrl_gic.h)
 int32_t IRQ_Initialize(void){
 	uint32_t i;
@@ -34,11 +46,75 @@ int32_t IRQ_Initialize(void){
 	for (i = 0U; i < IRQ_GIC_LINE_COUNT; i++) {
 		IRQTable[i] = (IRQHandler_t)NULL;
 	}
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	tru_pmu_ccnt_enable();  // Cycle counter for the handler statistics
+#endif
+#if defined(TRU_AMP_CORE1) && TRU_AMP_CORE1 == 1U
+	GIC_CPUInterfaceInit();  // AMP image on CPU1, the distributor is shared and set up by CPU0 (see c5soc/tru_c5soc_hps_amp.h)
+#else
 	GIC_Enable();
+#endif
 
 	return (0U);
 }
 
+// Calls the user registered handler of an acknowledged interrupt
+static inline __attribute__((always_inline)) void irq_dispatch(IRQn_ID_t irq_id){
+	IRQn_ID_t irq_num = irq_id & 0x3FFU;  // Ignore CPUID field (SGI sent from the other CPU)
+
+	if((irq_num >= 0U) && (irq_num < (IRQn_ID_t)IRQ_GIC_LINE_COUNT)){
+		irq_ctx_entry_t *entry = &irq_ctx_table[irq_num];
+		irq_ctx_handler_t handler = entry->handler;
+
+#if TRU_VFP_LAZY_ENABLED == 1U
+		if(tru_vfp_lazy_irq_uses_fp(irq_num)) tru_vfp_lazy_save();  // Save now rather than trap
+#endif
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+		uint32_t ccnt = tru_pmu_ccnt();
+#endif
+		if(handler != NULL){
+			handler(entry->ctx);  // Call the user registered context handler
+		}else{
+			IRQTable[irq_num]();  // Call the user registered IRQ handler
+		}
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+		tru_irq_stats_add(irq_num, tru_pmu_ccnt() - ccnt);
+#endif
+	}
+}
+
+// Dispatches an acknowledged interrupt ID for an IRQ_Handler supplied from outside, e.g. the FreeRTOS port (see c5soc/tru_c5soc_freertos.c)
+TRU_TLB_LOCK_TEXT void irq_dispatch_id(IRQn_ID_t irq_id){
+	irq_dispatch(irq_id);
+}
+
+#if defined(TRU_CMSIS_WEAK_IRQH) && !TRU_CMSIS_WEAK_IRQH && defined(TRU_NESTED_IRQ) && TRU_NESTED_IRQ == 1U
+// =====================
+// Nested IRQ dispatcher
+// =====================
+// The handler switches to SYS mode on a separate per CPU stack and unmasks the IRQ after the acknowledge, so an interrupt
+// with a higher group priority (lower value) preempts the running handler.  The GIC keeps the running priority of each
+// acknowledged interrupt, equal or lower priority interrupts stay pending until the EOI, which is written in the reverse
+// order of the acknowledges (the GIC requires this).  The IRQ mode stack only holds the return state, 7 words per level.
+
+#define IRQ_NEST_STACK_SHIFT 13  // 8KB per CPU, without the U suffix because it is also used in the assembly
+#define IRQ_NEST_STR_(x) #x
+#define IRQ_NEST_STR(x) IRQ_NEST_STR_(x)
+
+// Used by the assembly below only
+uint64_t irq_nest_stack[2][(1U << IRQ_NEST_STACK_SHIFT) / sizeof(uint64_t)];
+uint32_t irq_nest_depth[2];
+
+TRU_TLB_LOCK_TEXT void irq_dispatch_nested(IRQn_ID_t irq_id){
+	irq_dispatch(irq_id);
+}
+
+// Returns the nesting depth of the calling CPU, 0 = not in the IRQ handler
+uint32_t irq_nest_level(void){
+	return irq_nest_depth[__get_MPIDR() & 3U];
+}
+#endif
+
 #if defined(TRU_CMSIS_WEAK_IRQH) && !TRU_CMSIS_WEAK_IRQH
 // Disable: warning: FP registers might be clobbered despite 'interrupt' attribute: compile with '-mgeneral-regs-only' [-Wattributes]
 // The warning is about some ARM CPUs, e.g. Cortex A series do not automatically save floating point registers on interrupt.
@@ -46,10 +122,78 @@ int32_t IRQ_Initialize(void){
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wattributes"
 
+#if defined(TRU_NESTED_IRQ) && TRU_NESTED_IRQ == 1U
+// Overrride CMSIS default weak prototype (see irq_ctrl_gic.h).  Nested version, see above
+TRU_TLB_LOCK_TEXT void __attribute__((naked)) IRQ_Handler(void){
+	__ASM volatile(
+		"SUB    lr, lr, #4                    \n"  // Return address
+		"SRSDB  sp!, #0x12                    \n"  // Push LR_irq and SPSR_irq onto the IRQ stack
+		"PUSH   {r0-r3, r12}                  \n"  // Push the registers a C function may corrupt
+		"CPS    #0x1F                         \n"  // Switch to SYS mode, the IRQ stays masked
+		"MOV    r0, sp                        \n"  // Interrupted SYS mode SP
+		"MRC    p15, 0, r1, c0, c0, 5         \n"  // Read MPIDR
+		"AND    r1, r1, #3                    \n"  // CPU number
+		"LDR    r2, =irq_nest_depth           \n"
+		"LDR    r3, [r2, r1, LSL #2]          \n"
+		"ADD    r3, r3, #1                    \n"
+		"STR    r3, [r2, r1, LSL #2]          \n"  // Increment the nesting depth
+		"CMP    r3, #1                        \n"  // Outermost level?
+		"LDREQ  r2, =irq_nest_stack           \n"
+		"ADDEQ  r3, r1, #1                    \n"
+		"ADDEQ  r2, r2, r3, LSL #" IRQ_NEST_STR(IRQ_NEST_STACK_SHIFT) " \n"
+		"MOVEQ  sp, r2                        \n"  // Yes, switch to the top of the nested IRQ stack of this CPU
+		"MOV    r2, sp                        \n"
+		"BIC    r2, r2, #7                    \n"
+		"MOV    sp, r2                        \n"  // Align SP to 8 bytes as required by the AAPCS
+		"PUSH   {r0, lr}                      \n"  // Push the interrupted SP and LR_sys
+		"PUSH   {r4, r5}                      \n"  // r4 holds the interrupt ID, r5 keeps the stack 8 byte aligned
+		// Save floating point registers (VFP registers)
+#if TRU_VFP_LAZY_ENABLED == 1U
+		TRU_VFP_LAZY_ENTRY_ASM  // Only disables the VFP, the registers are saved on the first use (see arm/tru_vfp_lazy.h)
+#elif defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+		"VMRS   r0, fpscr                     \n"  // Read FP status value
+		"PUSH   {r0, r1}                      \n"  // Push FP status value, r1 is a dummy to keep the stack 8 byte aligned
+		"VSTMDB sp!, {d0-d15}                 \n"  // Push d0-d15 VFP registers
+		"VSTMDB sp!, {d16-d31}                \n"  // Push d16-d31 VFP registers
+#endif
+		"BL     IRQ_GetActiveIRQ              \n"  // Acknowledge, the GIC running priority is raised to the priority of this interrupt
+		"MOV    r4, r0                        \n"
+		"CPSIE  i                             \n"  // Unmask the IRQ, a higher priority interrupt can now preempt
+		"BL     irq_dispatch_nested           \n"
+		"CPSID  i                             \n"
+		"MOV    r0, r4                        \n"
+		"BL     IRQ_EndOfInterrupt            \n"  // Set interrupt is serviced, drops the running priority
+		// Restore floating point registers (VFP registers)
+#if TRU_VFP_LAZY_ENABLED == 1U
+		TRU_VFP_LAZY_EXIT_ASM
+#elif defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+		"VLDMIA sp!, {d16-d31}                \n"  // Pop into d16-d31 registers
+		"VLDMIA sp!, {d0-d15}                 \n"  // Pop into d0-d15 registers
+		"POP    {r0, r1}                      \n"
+		"VMSR   fpscr, r0                     \n"  // Restore FP status value
+#endif
+		"POP    {r4, r5}                      \n"
+		"POP    {r0, lr}                      \n"
+		"MOV    sp, r0                        \n"  // Back to the interrupted SYS mode stack
+		"MRC    p15, 0, r1, c0, c0, 5         \n"
+		"AND    r1, r1, #3                    \n"
+		"LDR    r2, =irq_nest_depth           \n"
+		"LDR    r3, [r2, r1, LSL #2]          \n"
+		"SUB    r3, r3, #1                    \n"
+		"STR    r3, [r2, r1, LSL #2]          \n"  // Decrement the nesting depth
+		"CPS    #0x12                         \n"  // Back to IRQ mode
+		"CLREX                                \n"  // Clear the local exclusive monitor (see below)
+		"POP    {r0-r3, r12}                  \n"
+		"RFEIA  sp!                           \n"  // Return to the interrupted code, restoring CPSR from SPSR_irq
+	);
+}
+#else
 // Overrride CMSIS default weak prototype (see irq_ctrl_gic.h)
-void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
+TRU_TLB_LOCK_TEXT void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
 	// Save floating point registers (VFP registers)
-#if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+#if TRU_VFP_LAZY_ENABLED == 1U
+	TRU_VFP_LAZY_IRQ_ENTRY();  // Only disables the VFP, the registers are saved on the first use (see arm/tru_vfp_lazy.h)
+#elif defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
 	__ASM volatile(
 		"SUB    sp, sp, #4      \n"  // Correct SP early by pushing a dummy, which will make it even for the r0 push below (number of pushes must be even)
 		"VMRS   r0, fpscr       \n"  // Read FP status value
@@ -60,15 +204,13 @@ void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
 #endif
 
 	IRQn_ID_t irq_id = IRQ_GetActiveIRQ();  // Get ID of the triggered interrupt
-
-	if((irq_id >= 0U) && (irq_id < (IRQn_ID_t)IRQ_GIC_LINE_COUNT)){
-		IRQTable[irq_id]();  // Call the user registered IRQ handler
-	}
-
-	int32_t status = IRQ_EndOfInterrupt(irq_id);  // Set interrupt is serviced
+	irq_dispatch(irq_id);
+	int32_t status = IRQ_EndOfInterrupt(irq_id);  // Set interrupt is serviced, with the CPUID field as required by the GIC
 
 	// Restore floating point registers (VFP registers)
-#if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+#if TRU_VFP_LAZY_ENABLED == 1U
+	TRU_VFP_LAZY_IRQ_EXIT();
+#elif defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
 	__ASM volatile(
 		"VLDMIA sp!, {d16-d31}  \n"  // Pop into d16-d31 registers
 		"VLDMIA sp!, {d0-d15}   \n"  // Pop into d0-d15 registers
@@ -77,7 +219,11 @@ void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
 		"ADD    sp, sp, #4      \n"  // Pop the dummy we pushed earlier
 	);
 #endif
+
+	// Clear the local exclusive monitor, so an interrupted LDREX/STREX sequence (tru_atomic.h) retries instead of storing
+	__ASM volatile("CLREX" ::: "memory");
 }
+#endif
 
 #pragma GCC diagnostic pop
 #endif
@@ -98,6 +244,36 @@ IRQHandler_t IRQ_GetHandler(IRQn_ID_t irqn) {
 	return (h);
 }
 
+/*
+	Registers a handler that is called with ctx, e.g. the driver instance of the
+	controller that owns the line.  Takes precedence over the IRQTable handler
+	of the line, a NULL handler removes it.  An enabled line is disabled while
+	the entry changes.  Returns 0 on success, or -1 for an invalid line.
+*/
+int32_t irq_set_ctx_handler(IRQn_ID_t irqn, irq_ctx_handler_t handler, void *ctx){
+	if((irqn < 0) || (irqn >= (IRQn_ID_t)IRQ_GIC_LINE_COUNT)) return -1;
+
+	irq_ctx_entry_t *entry = &irq_ctx_table[irqn];
+	uint32_t enabled = IRQ_GetEnableState(irqn);
+
+	// The line is disabled while the entry changes, so the dispatcher never sees the new handler with the old context
+	IRQ_Disable(irqn);
+	entry->handler = handler;
+	entry->ctx = ctx;
+	__DSB();  // The other CPU sees the entry before the line is enabled again
+	if(enabled) IRQ_Enable(irqn);
+
+	return 0;
+}
+
+// Returns the context registered with irq_set_ctx_handler(), or NULL
+void *irq_get_ctx(IRQn_ID_t irqn){
+	irqn &= 0x3FFU;  // Ignore CPUID field (software generated interrupts)
+	if(irqn >= (IRQn_ID_t)IRQ_GIC_LINE_COUNT) return NULL;
+
+	return irq_ctx_table[irqn].ctx;
+}
+
 /*
     Sets the priority level for an IRQ.
     Arm's priority order, e.g. for binary point 2:
@@ -116,8 +292,8 @@ void irq_set_group_priority(IRQn_ID_t irqn, uint8_t grp_priority, uint8_t sub_pr
 
 	// Invalid binary point?
 	if(num_grp_bits != IRQ_PRIORITY_ERROR){
-		gp_bits = ((1U << num_grp_bits) - 1U) | grp_priority;  // Calculate group priority bits offsetted to LSB bit position apply priority value
-		sp_bits = ((1U << num_sub_bits) - 1U) | sub_priority;  // Calculate sub priority bits
+		gp_bits = ((1U << num_grp_bits) - 1U) & grp_priority;  // Mask the group priority value to the number of group bits
+		sp_bits = ((1U << num_sub_bits) - 1U) & sub_priority;  // Mask the sub priority value to the number of sub bits
 		priority = gp_bits << num_sub_bits | sp_bits;
 	}else{
 		priority = 0xf7U;  // Error, assume binary point 2 and setting to lowest priority (30, 7)
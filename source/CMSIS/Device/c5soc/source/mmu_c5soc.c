@@ -31,6 +31,8 @@
 	Notes:
 	- the Peripherals+L3, Boot ROM, SCU+L2 and OCRAM memory regions had to be combined because their sizes do not align to 1MB
 	- bottom 1MB region is assumed to be remapped to SDRAM
+	- with TRU_OCRAM == 1U the last 1MB section is split with a L2 page table, so the OCRAM can be normal executable
+	  memory (see mmu_create_ocram_table_entries())
 	+-----------------------------------------------------------------------------------------------------------------+
 	| Region                             | Address Range           | MMU table entry attributes                       |
 	|-----------------------------------------------------------------------------------------------------------------|
@@ -142,6 +144,17 @@
 
 MMU_L1_SECTION uint8_t mmu_ttb_l1[L1_SIZE];
 
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U && defined(TRU_MMU) && TRU_MMU == 1U && USE_L1_AND_L2_TABLE == 0U
+	#if defined(__ICCARM__)
+		#define MMU_L2_OCRAM_SECTION _Pragma("location=\"mmu_ttb_l2_entries\"")
+	#else
+		#define MMU_L2_OCRAM_SECTION __attribute__((section("mmu_ttb_l2_entries"), aligned(1024)))
+	#endif
+
+	// L2 table (1kB) for the last 1MB section, which contains the OCRAM
+	MMU_L2_OCRAM_SECTION uint32_t mmu_ttb_l2_ocram[256];
+#endif
+
 #if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U && defined(TRU_MMU) && TRU_MMU == 1U
 	extern uint32_t __dma_buffer_start;  // Reference external symbol name from the linker file
 	extern uint32_t __dma_buffer_end;  // Reference external symbol name from the linker file
@@ -481,3 +494,52 @@ void *mmu_get_ttb_l1(void){
 		}
 	}
 #endif
+
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U && defined(TRU_MMU) && TRU_MMU == 1U && USE_L1_AND_L2_TABLE == 0U
+	/*
+		Replaces the last 1MB device section (0xFFF00000 - 0xFFFFFFFF) with a L2
+		page table, so the 64kB OCRAM can be normal, cacheable and executable
+		memory while the rest (peripherals, Boot ROM, SCU and L2 registers)
+		stays as 4K device pages.  This must be called before MMU_Enable().
+	*/
+	void mmu_create_ocram_table_entries(void){
+		mmu_region_attributes_Type region;
+		uint32_t L1_4k_Attrib_Device_RW;    // 4K page descriptor with attributes: device, RW, shared, non-cacheable
+		uint32_t L2_4k_Attrib_Device_RW;    // 4K page descriptor with attributes: device, RW, shared, non-cacheable
+		uint32_t L1_64k_Attrib_Normal_RWX;  // 64K page descriptor with attributes: normal, RWX, shared, inner cacheable
+		uint32_t L2_64k_Attrib_Normal_RWX;  // 64K page descriptor with attributes: normal, RWX, shared, inner cacheable
+		uint32_t *mmu_ttb_l1 = mmu_get_ttb_l1();
+
+		region.rg_t = PAGE_4k;
+		region.domain = 0x0;
+		region.e_t = ECC_DISABLED;
+		region.g_t = GLOBAL;
+		region.inner_norm_t = NON_CACHEABLE;
+		region.outer_norm_t = NON_CACHEABLE;
+		region.mem_t = SHARED_DEVICE;
+		region.sec_t = SECURE;
+		region.xn_t = NON_EXECUTE;
+		region.priv_t = RW;
+		region.user_t = RW;
+		region.sh_t = SHARED;
+		MMU_GetPageDescriptor(&L1_4k_Attrib_Device_RW, &L2_4k_Attrib_Device_RW, region);
+
+		region.rg_t = PAGE_64k;
+		region.domain = 0x0;
+		region.e_t = ECC_DISABLED;
+		region.g_t = GLOBAL;
+		region.inner_norm_t = WB_WA;          // Inner = L1 cache
+		region.outer_norm_t = NON_CACHEABLE;  // Outer = L2 cache, no point caching on-chip RAM again
+		region.mem_t = NORMAL;
+		region.sec_t = SECURE;
+		region.xn_t = EXECUTE;
+		region.priv_t = RW;
+		region.user_t = RW;
+		region.sh_t = SHARED;
+		MMU_GetPageDescriptor(&L1_64k_Attrib_Normal_RWX, &L2_64k_Attrib_Normal_RWX, region);
+
+		MMU_TTPage4k(mmu_ttb_l1, C5SOC_OCRAM_BASE & 0xfff00000UL, 240U, L1_4k_Attrib_Device_RW, mmu_ttb_l2_ocram, L2_4k_Attrib_Device_RW);  // Define 4k pages for 0xFFF00000 - 0xFFFEFFFF
+		MMU_TTPage64k(mmu_ttb_l1, C5SOC_OCRAM_BASE, 1U, L1_64k_Attrib_Normal_RWX, mmu_ttb_l2_ocram, L2_64k_Attrib_Normal_RWX);               // Define 64k page for OCRAM
+		__DSB();  // Ensure the new entries are visible
+	}
+#endif
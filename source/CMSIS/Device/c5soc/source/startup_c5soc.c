@@ -24,6 +24,10 @@
 
 #include <c5soc.h>
 #include <core_ca.h>
+#include "tru_boot_ts.h"
+
+#define TRU_BOOT_TS_XSTR(x) #x
+#define TRU_BOOT_TS_STR(x)  TRU_BOOT_TS_XSTR(x)
 
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
   #define RESET_ARGS int argc, char *const argv[]
@@ -47,6 +51,7 @@
  *----------------------------------------------------------------------------*/
 void Vectors        (void)       __attribute__ ((naked, section("RESET")));
 void Reset_Handler  (RESET_ARGS) __attribute__ ((naked));
+void Reset_Handler_core1(void)   __attribute__ ((naked));
 void Default_Handler(void);
 
 /*----------------------------------------------------------------------------
@@ -88,6 +93,21 @@ void Reset_Handler(RESET_ARGS) {
   // Mask interrupts
   "CPSID   if                                      \n"
 
+#if defined(TRU_BOOT_TS) && TRU_BOOT_TS == 1U
+  // Boot timestamp of the reset handler entry (see tru_boot_ts.h)
+  // Only r2, r3 and r12 are used, so the U-Boot arguments and return address are kept
+  "LDR     r12, =0xfffec200UL                      \n"  // Load global timer base register
+  "LDR     r2, [r12, #0x8]                         \n"  // Read global timer control register
+  "TST     r2, #0x1                                \n"  // Is the timer enabled?
+  "MOVEQ   r2, #0x1                                \n"  // No, enable it without prescaler, compare and interrupt
+  "STREQ   r2, [r12, #0x8]                         \n"
+  "LDR     r3, [r12, #0x0]                         \n"  // Read global timer counter lower 32 bits
+  "LDR     r12, =__boot_ts_start                   \n"  // Load boot timestamp buffer address
+  "STR     r3, [r12, #0x4]                         \n"  // Store reset stage ticks
+  "MOV     r2, #0x1                                \n"
+  "STR     r2, [r12, #0x0]                         \n"  // Set valid mask to the reset stage only
+#endif
+
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
   // Save U-Boot argc
   "LDR r3, =uboot_argc                             \n"
@@ -133,6 +153,7 @@ void Reset_Handler(RESET_ARGS) {
 #endif
 
   // Put any cores other than 0 to sleep
+  // Note, CPU1 is not started here, it is started by CPU0 at Reset_Handler_core1 (see c5soc/tru_c5soc_hps_smp.h)
 	/*
   "MRC     p15, 0, R0, c0, c0, 5                   \n"  // Read MPIDR
   "ANDS    R0, R0, #3                              \n"
@@ -198,13 +219,19 @@ void Reset_Handler(RESET_ARGS) {
   "CPS    #0x1F                                    \n"
   "LDR    SP, =Image$$SYS_STACK$$ZI$$Limit         \n"
 
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U
+  // Copy down code and data to the OCRAM (see tru_c5soc_hps_ocram.h)
+  "BL     tru_hps_ocram_init                       \n"
+#endif
+
   // Call SystemInit
   "BL     SystemInit                               \n"
 
-#if defined(TRU_SCU) && TRU_SCU == 1U
+#if defined(TRU_SCU) && TRU_SCU == 1U && !(defined(TRU_AMP_CORE1) && TRU_AMP_CORE1 == 1U)
   // =======================================
   // Initialise the SCU (Snoop Control Unit)
   // =======================================
+  // Note, not for the CPU1 image of an AMP pair, the SCU is shared and set up by CPU0
 
   // Invalidate SCU
   "LDR    r0, =0xfffec000UL                        \n"  // Load SCU base register
@@ -228,11 +255,90 @@ void Reset_Handler(RESET_ARGS) {
   "MCR    p15, 0, r0, c1, c0, 1                    \n"  // Write ACTLR
 #endif
 
+#if defined(TRU_BOOT_TS) && TRU_BOOT_TS == 1U
+  "MOV    r0, #" TRU_BOOT_TS_STR(TRU_BOOT_TS_SCU_SMP) "\n"
+  "BL     tru_boot_ts_mark_id                      \n"
+#endif
+
   // Unmask interrupts
   "CPSIE  if                                       \n"
 
+#if defined(TRU_BOOT_TS) && TRU_BOOT_TS == 1U
+  "MOV    r0, #" TRU_BOOT_TS_STR(TRU_BOOT_TS_START) "\n"
+  "BL     tru_boot_ts_mark_id                      \n"
+#endif
+
+#if defined(TRU_FAST_CRT) && TRU_FAST_CRT == 1U
+  // Call the fast C runtime start (see tru_crt.h)
+  "BL     _tru_start                               \n"
+#else
   // Call newlib start
   "BL     _start                                   \n"
+#endif
+  );
+}
+
+/*----------------------------------------------------------------------------
+  Reset Handler for the second core (CPU1), started by tru_hps_smp_start_core1()
+ *----------------------------------------------------------------------------*/
+void Reset_Handler_core1(void) {
+  __ASM volatile(
+
+  // Mask interrupts
+  "CPSID   if                                      \n"
+
+  // Reset SCTLR Settings
+  "MRC     p15, 0, R0, c1, c0, 0                   \n"  // Read CP15 System Control register
+  "BIC     R0, R0, #(0x1 << 12)                    \n"  // Clear I bit 12 to disable I Cache
+  "BIC     R0, R0, #(0x1 << 11)                    \n"  // Clear Z bit 11 to disable branch prediction
+  "BIC     R0, R0, #(0x1 <<  2)                    \n"  // Clear C bit  2 to disable D Cache
+  "BIC     R0, R0, #0x1                            \n"  // Clear M bit  0 to disable MMU
+  "BIC     R0, R0, #(0x1 << 13)                    \n"  // Clear V bit 13 to disable hivecs
+  "MCR     p15, 0, R0, c1, c0, 0                   \n"  // Write value back to CP15 System Control register
+  "ISB                                             \n"  // Ensures writes have completed
+
+  // Configure ACTLR
+  "MRC     p15, 0, r0, c1, c0, 1                   \n"  // Read CP15 Auxiliary Control Register
+  "ORR     r0, r0, #(1 << 1)                       \n"  // Enable L2 prefetch hint (UNK/WI since r4p1)
+  "MCR     p15, 0, r0, c1, c0, 1                   \n"  // Write CP15 Auxiliary Control Register
+
+  // Configure access permissions (switch into secure access mode)
+  "MRC    p15, 0, r0, c1, c1, 2                    \n"  // Read from NSACR (Non-secure Access Control Register)
+  "ORR    r0, r0, #(0x3 << 20)                     \n"  // Setup bits to enable access permissions.  Undocumented Altera/Intel Cyclone V SoC vendor specific
+  "MCR    p15, 0, r0, c1, c1, 2                    \n"  // Write to NSACR
+  "ISB                                             \n"  // Ensures writes have completed
+
+  // Set Vector Base Address Register (VBAR) to point to this application's vector table
+  "LDR    R0, =Vectors                             \n"
+  "MCR    p15, 0, R0, c12, c0, 0                   \n"
+
+  // Setup CPU1 Stack for each exceptional mode
+  "CPS    #0x11                                    \n"
+  "LDR    SP, =__FIQ_STACK1_LIMIT                  \n"
+  "CPS    #0x12                                    \n"
+  "LDR    SP, =__IRQ_STACK1_LIMIT                  \n"
+  "CPS    #0x13                                    \n"
+  "LDR    SP, =__SVC_STACK1_LIMIT                  \n"
+  "CPS    #0x17                                    \n"
+  "LDR    SP, =__ABT_STACK1_LIMIT                  \n"
+  "CPS    #0x1B                                    \n"
+  "LDR    SP, =__UND_STACK1_LIMIT                  \n"
+  "CPS    #0x1F                                    \n"
+  "LDR    SP, =__SYS_STACK1_LIMIT                  \n"
+
+  // Call SystemInit for CPU1
+  "BL     SystemInit_core1                         \n"
+
+  // Unmask interrupts
+  "CPSIE  if                                       \n"
+
+  // Call the user entry point for CPU1
+  "BL     main_core1                               \n"
+
+  // Sleep if it returns
+"_core1_sleep:                                     \n"
+  "WFI                                             \n"
+  "B      _core1_sleep                             \n"
   );
 }
 
@@ -29,8 +29,12 @@
 #include "RTE_Components.h"
 #include CMSIS_device_header
 #include "irq_ctrl.h"
+#include "arm/tru_cortex_a9_tlb.h"
+#include "tru_boot_ts.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include "c5soc/tru_c5soc_hps_clkmgr.h"
 
-#define SYSTEM_CLOCK 800000000UL
+#define SYSTEM_CLOCK 800000000UL  // Until SystemCoreClockUpdate() reads the clock manager
 
 /*----------------------------------------------------------------------------
   System Core Clock Variable
@@ -41,7 +45,9 @@ uint32_t SystemCoreClock = SYSTEM_CLOCK;
   System Core Clock update function
  *----------------------------------------------------------------------------*/
 void SystemCoreClockUpdate(){
-  SystemCoreClock = SYSTEM_CLOCK;
+  uint32_t hz = tru_hps_clkmgr_get_mpu_hz();  // MPU PLL and dividers as set up by the preloader
+
+  SystemCoreClock = hz ? hz : SYSTEM_CLOCK;
 }
 
 /*----------------------------------------------------------------------------
@@ -51,6 +57,8 @@ void SystemInit(){
 /* do not use global variables because this function is called before
    reaching pre-main. RW section may be overwritten afterwards.          */
 
+  tru_boot_ts_mark(TRU_BOOT_TS_SYSINIT);
+
 #if defined(TRU_MMU) && TRU_MMU == 1U
   // Invalidate entire Unified TLB
   __set_TLBIALL(0);
@@ -70,6 +78,7 @@ void SystemInit(){
   // Invalidate data cache
   L1C_InvalidateDCacheAll();
 #endif
+  tru_boot_ts_mark(TRU_BOOT_TS_INVALIDATE);
 
 #if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
   __FPU_Enable();
@@ -79,17 +88,28 @@ void SystemInit(){
   MMU_CreateTranslationTable();
 #if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U
   mmu_create_dma_buffer_table_entries();
+#endif
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U && USE_L1_AND_L2_TABLE == 0U
+  mmu_create_ocram_table_entries();
 #endif
   MMU_Enable();
+  tru_boot_ts_mark(TRU_BOOT_TS_MMU);
 #endif
 
 #if defined(TRU_L1_CACHE) && TRU_L1_CACHE == 1U
   // Enable L1 caches
   L1C_EnableCaches();
   L1C_EnableBTAC();
+  tru_boot_ts_mark(TRU_BOOT_TS_L1_ENABLE);
 #endif
 
 #if defined(TRU_L2_CACHE) && TRU_L2_CACHE == 1U && __L2C_PRESENT == 1U
+#if defined(TRU_AMP_CORE1) && TRU_AMP_CORE1 == 1U
+  // AMP image on CPU1, the L2 cache is shared and already enabled by CPU0 (see c5soc/tru_c5soc_hps_amp.h)
+#if defined(TRU_FAST_CRT) && TRU_FAST_CRT == 1U
+  if(L2C_310->AUX_CNT & 1U) __set_ACTLR(__get_ACTLR() | (1U << 3U));  // Match the full line of zeros mode of the L2C-310 set by CPU0
+#endif
+#else
   //L2C_310->AUX_CNT = L2C_310->AUX_CNT & ~(1U << 29U | 1U << 28U);  // Disable L2 instruction and data prefetch
   //L2C_310->AUX_CNT = L2C_310->AUX_CNT & ~(1U << 21U);  // Disable L2 parity
 
@@ -97,8 +117,78 @@ void SystemInit(){
   __IOM uint32_t *L2C_310_REG1_DATA_RAM_CNT = (__IOM uint32_t *)L2C_310_BASE + 0x10cU;
   *L2C_310_REG1_DATA_RAM_CNT = (*L2C_310_REG1_DATA_RAM_CNT & ~0x777U) | 0x10U;  // Read access set to 2 cycles of latency (value taken from Intel/Altera HWLib)
 
+#if defined(TRU_FAST_CRT) && TRU_FAST_CRT == 1U
+  // Enable the full line of zeros mode, used by the fast .bss clear (see tru_crt.h)
+  // The L2C-310 must have it enabled before the Cortex-A9, and the auxiliary control register can only be written while the L2 is disabled
+  L2C_310->CONTROL = 0U;
+  L2C_310->AUX_CNT = L2C_310->AUX_CNT | 1U;
+#endif
+
   L2C_Enable();
+
+#if defined(TRU_FAST_CRT) && TRU_FAST_CRT == 1U
+  __set_ACTLR(__get_ACTLR() | (1U << 3U));  // Set bit 3 to enable write full line of zeros mode
+#endif
+  tru_boot_ts_mark(TRU_BOOT_TS_L2_ENABLE);
+#endif
+#endif
+
+#if defined(TRU_TLB_LOCK) && TRU_TLB_LOCK == 1U && defined(TRU_MMU) && TRU_MMU == 1U
+  // Preload and lock the translations of the IRQ entry path (see tru_cortex_a9_tlb.h)
+  tru_tlb_lock_regions();
+  tru_boot_ts_mark(TRU_BOOT_TS_TLB_LOCK);
 #endif
 
   IRQ_Initialize();  // Initialise the IRQ system, e.g. user interrupt handler table and GIC system
+  tru_boot_ts_mark(TRU_BOOT_TS_IRQ_INIT);
+}
+
+/*----------------------------------------------------------------------------
+  System Initialization for the second core (CPU1)
+ *----------------------------------------------------------------------------*/
+void SystemInit_core1(){
+/* CPU0 has already set up the MMU table, L2 cache, SCU and GIC distributor.
+   The CPU0 settings are read from tru_hps_smp_boot, which CPU0 has cleaned
+   to memory (see c5soc/tru_c5soc_hps_smp.h).                              */
+
+  // Invalidate entire Unified TLB, branch predictor array, instruction and data cache
+  __set_TLBIALL(0);
+  __set_BPIALL(0);
+  __set_ICIALLU(0);
+  __DSB();
+  __ISB();
+  L1C_InvalidateDCacheAll();
+
+#if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+  __FPU_Enable();
+#endif
+
+#if defined(TRU_SMP_COHERENCY) && TRU_SMP_COHERENCY == 1U
+  // Join SMP cache coherency before the caches are enabled
+  __set_ACTLR(__get_ACTLR() | (0x1U << 22U) | ACTLR_SMP_Msk | ACTLR_FW_Msk);  // Shared attribute override, SMP and maintenance broadcast, same as CPU0
+#endif
+
+  // Enable the MMU with the translation table of CPU0
+  if(tru_hps_smp_boot.sctlr & SCTLR_M_Msk){
+    __set_CP(15, 0, tru_hps_smp_boot.ttbcr, 2, 0, 2);  // Set TTBCR
+    __set_TTBR0(tru_hps_smp_boot.ttbr0);
+    __set_DACR(tru_hps_smp_boot.dacr);
+    __ISB();
+    MMU_Enable();
+  }
+
+  // Enable L1 caches
+  if(tru_hps_smp_boot.sctlr & SCTLR_C_Msk){
+    L1C_EnableCaches();
+    L1C_EnableBTAC();
+  }
+
+#if defined(TRU_FAST_CRT) && TRU_FAST_CRT == 1U && defined(TRU_L2_CACHE) && TRU_L2_CACHE == 1U && __L2C_PRESENT == 1U
+  // Match the full line of zeros mode of the L2C-310 set by CPU0
+  if(L2C_310->AUX_CNT & 1U) __set_ACTLR(__get_ACTLR() | (1U << 3U));
+#endif
+
+  GIC_CPUInterfaceInit();  // Enable the GIC CPU interface of this CPU, the distributor is shared and was set up by CPU0
+
+  tru_hps_smp_boot.started = 1U;
 }
@@ -0,0 +1,72 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Common helpers for the benchmarks.  The timings use the Cortex-A9 global
+	timer, which is clocked from the peripheral base clock (1/4 of the
+	processor clock).
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "tru_config.h"
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "arm/tru_cortex_a9.h"
+#include "tru_time.h"
+#include <stdint.h>
+
+#define BENCH_TIMER_HZ (SystemCoreClock / 4U)
+
+// Starts the global timer if it is not already running
+static inline void bench_timer_init(void){
+	tru_time_ensure_started();
+}
+
+static inline uint64_t bench_now(void){
+	return tru_time_now_ticks();
+}
+
+static inline uint32_t bench_ticks_to_ns(uint64_t ticks){
+	return (uint32_t)tru_time_ticks_to_ns(ticks);
+}
+
+void bench_acp(void);
+void bench_ocram(void);
+void bench_crt(void);
+void bench_lock(void);
+void bench_queue(void);
+void bench_task(void);
+void bench_ipi(void);
+void bench_irq_nest(void);
+void bench_fiq(void);
+void bench_defer(void);
+void bench_irq_lat(void);
+void bench_co(void);
+void bench_freertos(void);
+void bench_thread(void);
+void bench_timer(void);
+
+#endif
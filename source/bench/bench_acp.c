@@ -0,0 +1,129 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	ACP coherent buffers vs. non-coherent buffers with cache maintenance.
+
+	For each transfer size it times the CPU side of a DMA round trip: make the
+	CPU written data visible to the master, then read back what the master
+	wrote.  A non-coherent buffer needs a clean before and an invalidate after,
+	and the read back misses the cache.  An ACP buffer only needs a barrier,
+	because the master's accesses are snooped by the SCU.  No FPGA master is
+	used here, so the figures are the CPU overhead saved per transfer.
+*/
+
+#include "bench.h"
+#include "tru_cache.h"
+#include "c5soc/tru_c5soc_hps_acp.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_ACP_REPEAT   64U
+#define BENCH_ACP_MAX_SIZE 65536U
+
+static const uint32_t bench_acp_sizes[] = {64U, 256U, 1024U, 4096U, 16384U, 65536U};
+
+static uint8_t bench_acp_nc_buf[BENCH_ACP_MAX_SIZE] __attribute__((aligned(CACHELINE_SIZE)));
+
+static uint32_t bench_acp_read_back(const uint8_t *buf, uint32_t len){
+	const volatile uint32_t *p = (const volatile uint32_t *)buf;
+	uint32_t sum = 0U;
+
+	for(uint32_t i = 0U; i < len / 4U; i++) sum += p[i];
+
+	return sum;
+}
+
+static uint64_t bench_acp_noncoherent(uint8_t *buf, uint32_t len){
+	bool l1 = tru_l1_is_dcache_enabled();
+	bool l2 = tru_l2_is_enabled();
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_ACP_REPEAT; i++){
+		memset(buf, (int)i, len);  // CPU produces the data
+
+		uint64_t t0 = bench_now();
+
+		// Before the master reads: write the dirty lines out to SDRAM
+		if(l1) tru_l1_data_clean_range(buf, len);
+		if(l2) tru_l2_data_clean_range(buf, len);
+
+		// After the master writes: discard the stale lines
+		if(l2) tru_l2_data_inv_range(buf, len);
+		if(l1) tru_l1_data_inv_range(buf, len);
+
+		bench_acp_read_back(buf, len);  // CPU consumes the data
+
+		total += bench_now() - t0;
+	}
+
+	return total / BENCH_ACP_REPEAT;
+}
+
+static uint64_t bench_acp_coherent(uint8_t *buf, uint32_t len){
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_ACP_REPEAT; i++){
+		memset(buf, (int)i, len);  // CPU produces the data
+
+		uint64_t t0 = bench_now();
+
+		__DSB();  // Only ordering of the CPU writes before starting the master is needed
+
+		bench_acp_read_back(buf, len);  // CPU consumes the data
+
+		total += bench_now() - t0;
+	}
+
+	return total / BENCH_ACP_REPEAT;
+}
+
+void bench_acp(void){
+	uint8_t *acp_buf;
+
+	bench_timer_init();
+	tru_hps_acp_init();
+
+	printf("ACP benchmark (average ns per transfer of %u runs)\n", (unsigned int)BENCH_ACP_REPEAT);
+	if(!tru_hps_acp_is_coherent()){
+		printf("Warning: SCU or ACTLR.SMP is not enabled, ACP accesses are not coherent\n");
+	}
+
+	acp_buf = tru_hps_acp_alloc(BENCH_ACP_MAX_SIZE);
+	if(acp_buf == NULL){
+		printf("Error: ACP pool too small\n");
+		return;
+	}
+
+	printf("%8s %14s %10s\n", "bytes", "non-coherent", "acp");
+	for(uint32_t i = 0U; i < sizeof(bench_acp_sizes) / sizeof(bench_acp_sizes[0]); i++){
+		uint32_t len = bench_acp_sizes[i];
+		uint32_t nc = bench_ticks_to_ns(bench_acp_noncoherent(bench_acp_nc_buf, len));
+		uint32_t acp = bench_ticks_to_ns(bench_acp_coherent(acp_buf, len));
+
+		printf("%8lu %14lu %10lu\n", (unsigned long)len, (unsigned long)nc, (unsigned long)acp);
+	}
+
+	tru_hps_acp_free_all();
+}
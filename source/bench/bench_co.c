@@ -0,0 +1,166 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Stackless coroutine scheduler (tru_co.h).
+
+	Yield: two coroutines yield to each other, the cost of one switch.
+
+	Pipeline: a source coroutine sleeps, then raises an SGI that stands for
+	a DMA completion IRQ.  The ISR signals an event, the rx coroutine wakes
+	(the CPU is in WFI meanwhile) and passes the block number through an SPSC
+	queue to the compute coroutine, which awaits the queue not being empty.
+	Prints the IRQ to rx coroutine latency.
+*/
+
+#include "bench.h"
+#include "tru_co.h"
+#include "tru_queue.h"
+#include "arm/tru_ipi.h"
+#include <stdio.h>
+
+#define BENCH_CO_YIELDS   10000U
+#define BENCH_CO_BLOCKS   100U
+#define BENCH_CO_SGI      SGI10_IRQn
+#define BENCH_CO_PERIOD   tru_time_us_to_ticks(50U)
+#define BENCH_CO_QUEUE_LEN 8U
+
+typedef struct{
+	uint32_t n;
+}bench_co_yield_t;
+
+typedef struct{
+	tru_co_event_t dma_done;
+	tru_spsc_t q;
+	uint32_t q_buf[BENCH_CO_QUEUE_LEN];
+	uint32_t sent;
+	uint32_t received;
+	uint32_t computed;
+	uint32_t sum;
+	volatile uint32_t t_irq;
+	uint64_t lat_sum;
+	uint32_t lat_max;
+}bench_co_pipe_t;
+
+static bench_co_pipe_t bench_co_pipe;
+
+static uint32_t bench_co_yield_fn(tru_co_t *co){
+	bench_co_yield_t *y = co->ctx;
+
+	TRU_CO_BEGIN(co);
+	for(y->n = 0U; y->n < BENCH_CO_YIELDS; y->n++){
+		TRU_CO_YIELD(co);
+	}
+	TRU_CO_END(co);
+}
+
+static void bench_co_dma_isr(void){
+	bench_co_pipe.t_irq = tru_pmu_ccnt();
+	tru_co_event_signal(&bench_co_pipe.dma_done);
+}
+
+static uint32_t bench_co_source_fn(tru_co_t *co){
+	bench_co_pipe_t *p = co->ctx;
+
+	TRU_CO_BEGIN(co);
+	for(p->sent = 0U; p->sent < BENCH_CO_BLOCKS; p->sent++){
+		TRU_CO_SLEEP(co, BENCH_CO_PERIOD);
+		tru_ipi_send_self(BENCH_CO_SGI);
+	}
+	TRU_CO_END(co);
+}
+
+static uint32_t bench_co_rx_fn(tru_co_t *co){
+	bench_co_pipe_t *p = co->ctx;
+
+	TRU_CO_BEGIN(co);
+	while(p->received < BENCH_CO_BLOCKS){
+		TRU_CO_AWAIT_EVENT(co, &p->dma_done);
+
+		uint32_t lat = tru_pmu_ccnt() - p->t_irq;
+		p->lat_sum += lat;
+		if(lat > p->lat_max) p->lat_max = lat;
+
+		TRU_CO_AWAIT(co, tru_spsc_push(&p->q, &p->received));
+		p->received++;
+	}
+	TRU_CO_END(co);
+}
+
+static uint32_t bench_co_compute_fn(tru_co_t *co){
+	bench_co_pipe_t *p = co->ctx;
+	uint32_t block;
+
+	TRU_CO_BEGIN(co);
+	while(p->computed < BENCH_CO_BLOCKS){
+		TRU_CO_AWAIT(co, tru_spsc_pop(&p->q, &block));
+		p->sum += block;
+		p->computed++;
+	}
+	TRU_CO_END(co);
+}
+
+void bench_co(void){
+	static bench_co_yield_t y[2];
+	static tru_co_t yield_co[2];
+	static tru_co_t source_co, rx_co, compute_co;
+	bench_co_pipe_t *p = &bench_co_pipe;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+
+	tru_pmu_ccnt_enable();
+	tru_co_cpu_init();
+	printf("Coroutine benchmark\n");
+
+	// Yield
+	tru_co_init(&yield_co[0], bench_co_yield_fn, &y[0]);
+	tru_co_init(&yield_co[1], bench_co_yield_fn, &y[1]);
+	tru_co_add(0U, &yield_co[0]);
+	tru_co_add(0U, &yield_co[1]);
+	uint32_t t0 = tru_pmu_ccnt();
+	tru_co_run();
+	uint32_t cycles = tru_pmu_ccnt() - t0;
+	printf("yield: %lu cycles per switch\n", (unsigned long)(cycles / (2U * BENCH_CO_YIELDS)));
+
+	// Pipeline
+	tru_co_event_init(&p->dma_done);
+	tru_spsc_init(&p->q, p->q_buf, sizeof(p->q_buf[0]), BENCH_CO_QUEUE_LEN);
+	tru_ipi_set_handler(BENCH_CO_SGI, bench_co_dma_isr);
+	tru_ipi_enable(BENCH_CO_SGI);
+	tru_co_init(&source_co, bench_co_source_fn, p);
+	tru_co_init(&rx_co, bench_co_rx_fn, p);
+	tru_co_init(&compute_co, bench_co_compute_fn, p);
+	tru_co_add(0U, &source_co);
+	tru_co_add(0U, &rx_co);
+	tru_co_add(0U, &compute_co);
+	tru_co_run();
+
+	printf("pipeline: %lu blocks, sum %lu (expected %lu)\n", (unsigned long)p->computed, (unsigned long)p->sum, (unsigned long)(BENCH_CO_BLOCKS * (BENCH_CO_BLOCKS - 1U) / 2U));
+	printf("irq to coroutine: avg %lu ns, worst %lu ns\n",
+		(unsigned long)(p->lat_sum / BENCH_CO_BLOCKS * 1000U / mhz),
+		(unsigned long)((uint64_t)p->lat_max * 1000U / mhz));
+
+	tru_ipi_disable(BENCH_CO_SGI);
+	tru_ipi_set_handler(BENCH_CO_SGI, NULL);
+	tru_co_cpu_exit();
+}
@@ -0,0 +1,84 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Clearing a 64MB block with newlib's memset() vs. tru_crt_zero(), the
+	routine used by _tru_start() to clear the .bss.  The block is taken from
+	the heap, so it is in cacheable DDR like the .bss.  Run it with and without
+	TRU_CFG_FAST_CRT to see the effect of the full line of zeros mode.
+
+	Note, for the boot time itself see the .bss clear stage of
+	tru_boot_ts_print() with a 64MB .bss array.
+*/
+
+#include "bench.h"
+#include "tru_crt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_CRT_SIZE   (64U * 1024U * 1024U)
+#define BENCH_CRT_REPEAT 4U
+
+static uint32_t bench_crt_memset(void *buf){
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_CRT_REPEAT; i++){
+		uint64_t t0 = bench_now();
+		memset(buf, 0, BENCH_CRT_SIZE);
+		total += bench_now() - t0;
+	}
+
+	return bench_ticks_to_ns(total / BENCH_CRT_REPEAT) / 1000U;
+}
+
+static uint32_t bench_crt_zero(void *buf){
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_CRT_REPEAT; i++){
+		uint64_t t0 = bench_now();
+		tru_crt_zero(buf, BENCH_CRT_SIZE);
+		total += bench_now() - t0;
+	}
+
+	return bench_ticks_to_ns(total / BENCH_CRT_REPEAT) / 1000U;
+}
+
+void bench_crt(void){
+	void *buf;
+
+	bench_timer_init();
+
+	buf = malloc(BENCH_CRT_SIZE);
+	if(buf == NULL){
+		printf("CRT benchmark: could not allocate %u bytes\n", (unsigned int)BENCH_CRT_SIZE);
+		return;
+	}
+
+	printf("CRT benchmark, clear 64MB (average us of %u runs)\n", (unsigned int)BENCH_CRT_REPEAT);
+	printf("%-26s %10lu\n", "memset()", (unsigned long)bench_crt_memset(buf));
+	printf("%-26s %10lu\n", "tru_crt_zero()", (unsigned long)bench_crt_zero(buf));
+
+	free(buf);
+}
@@ -0,0 +1,126 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Deferred work latency (tru_defer.h).
+
+	A device IRQ (an SGI sent to itself) posts one work item on each level and
+	returns.  The items are drained by the low priority SGI, then by the main
+	loop calling tru_defer_run().  Prints the hard IRQ time and the post to
+	start latency per level.
+*/
+
+#include "bench.h"
+#include "tru_defer.h"
+#include "arm/tru_ipi.h"
+#include <stdio.h>
+#include <stddef.h>
+
+#define BENCH_DEFER_DEV_SGI   SGI4_IRQn
+#define BENCH_DEFER_REPEAT    200U
+#define BENCH_DEFER_WORK_US   2U  // Each work item spins for this long
+#define BENCH_DEFER_TIMEOUT   10000000UL
+
+static volatile uint32_t bench_defer_done;
+static uint64_t bench_defer_isr_cycles;
+
+static void bench_defer_work(void *arg){
+	(void)arg;
+	uint64_t spin = (uint64_t)BENCH_DEFER_WORK_US * (BENCH_TIMER_HZ / 1000000U);
+	uint64_t t0 = bench_now();
+
+	while(bench_now() - t0 < spin);
+	bench_defer_done++;
+}
+
+// The device IRQ, only posts the work
+static void bench_defer_dev_isr(void){
+	uint32_t t0 = tru_pmu_ccnt();
+
+	tru_defer_post_local(TRU_DEFER_LOW, bench_defer_work, NULL);
+	tru_defer_post_local(TRU_DEFER_NORMAL, bench_defer_work, NULL);
+	tru_defer_post_local(TRU_DEFER_HIGH, bench_defer_work, NULL);
+	bench_defer_isr_cycles += tru_pmu_ccnt() - t0;
+}
+
+static int bench_defer_run(uint32_t mode){
+	bench_defer_isr_cycles = 0U;
+	if(tru_defer_init(mode)) return -1;
+
+	for(uint32_t i = 0U; i < BENCH_DEFER_REPEAT; i++){
+		uint32_t wait = 0U;
+
+		bench_defer_done = 0U;
+		__DSB();
+		tru_ipi_send_self(BENCH_DEFER_DEV_SGI);
+		while(bench_defer_done != TRU_DEFER_LEVELS){
+			if(mode == TRU_DEFER_MODE_IDLE) tru_defer_run();
+			if(++wait == BENCH_DEFER_TIMEOUT){
+				tru_defer_exit();
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void bench_defer_print(const char *name){
+	static const char *level_name[TRU_DEFER_LEVELS] = { "high", "normal", "low" };
+	uint32_t mhz = SystemCoreClock / 1000000U;
+
+	printf("%s, hard IRQ avg %lu ns\n", name, (unsigned long)(bench_defer_isr_cycles / BENCH_DEFER_REPEAT * 1000U / mhz));
+	printf("%-8s %8s %10s %10s %8s\n", "level", "count", "avg ns", "worst ns", "dropped");
+	for(uint32_t level = 0U; level < TRU_DEFER_LEVELS; level++){
+		tru_defer_stats_t s;
+
+		tru_defer_get_stats(0U, level, &s);
+		printf("%-8s %8lu %10lu %10lu %8lu\n",
+			level_name[level],
+			(unsigned long)s.count,
+			(unsigned long)(s.count ? bench_ticks_to_ns(s.lat_sum / s.count) : 0U),
+			(unsigned long)bench_ticks_to_ns(s.lat_max),
+			(unsigned long)s.dropped);
+	}
+}
+
+void bench_defer(void){
+	bench_timer_init();
+	tru_pmu_ccnt_enable();
+
+	printf("Deferred work benchmark (%u device IRQs, %u work items each)\n", (unsigned int)BENCH_DEFER_REPEAT, (unsigned int)TRU_DEFER_LEVELS);
+	tru_ipi_set_handler(BENCH_DEFER_DEV_SGI, bench_defer_dev_isr);
+	tru_ipi_enable(BENCH_DEFER_DEV_SGI);
+
+	if(bench_defer_run(TRU_DEFER_MODE_SGI)) printf("Error: SGI mode timeout\n");
+	else bench_defer_print("SGI drain");
+	tru_defer_exit();
+
+	if(bench_defer_run(TRU_DEFER_MODE_IDLE)) printf("Error: idle mode timeout\n");
+	else bench_defer_print("Idle loop drain");
+	tru_defer_exit();
+
+	tru_ipi_disable(BENCH_DEFER_DEV_SGI);
+	tru_ipi_set_handler(BENCH_DEFER_DEV_SGI, NULL);
+}
@@ -0,0 +1,111 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Latency from raising an interrupt to the handler code, through the IRQ
+	dispatcher (IRQ_Handler) and through the FIQ fast path (arm/tru_fiq.h).
+
+	The CPU sends an SGI to itself and reads the PMU cycle counter, the
+	handler reads it again.  An interrupt from the FPGA adds the f2h
+	interrupt synchronisation to this, the rest of the path is the same.
+*/
+
+#include "bench.h"
+#include "arm/tru_fiq.h"
+#include "arm/tru_ipi.h"
+#include <stdio.h>
+#include <stddef.h>
+
+#define BENCH_FIQ_SGI     SGI3_IRQn
+#define BENCH_FIQ_REPEAT  1000U
+#define BENCH_FIQ_TIMEOUT 10000000UL
+
+static volatile uint32_t bench_fiq_t1;
+static volatile uint32_t bench_fiq_done;
+
+// Used as both the IRQ handler and the FIQ callback, no floating point here
+static void bench_fiq_handler(void){
+	bench_fiq_t1 = tru_pmu_ccnt();
+	bench_fiq_done = 1U;
+}
+
+// Returns the average and worst latency in CPU cycles, or 0 on timeout
+static uint32_t bench_fiq_run(uint32_t *worst){
+	uint64_t total = 0U;
+
+	*worst = 0U;
+	for(uint32_t i = 0U; i < BENCH_FIQ_REPEAT; i++){
+		uint32_t wait = 0U;
+
+		bench_fiq_done = 0U;
+		__DSB();
+		uint32_t t0 = tru_pmu_ccnt();
+		tru_ipi_send_self(BENCH_FIQ_SGI);
+
+		while(!bench_fiq_done){
+			if(++wait == BENCH_FIQ_TIMEOUT) return 0U;
+		}
+
+		uint32_t cycles = bench_fiq_t1 - t0;
+		total += cycles;
+		if(cycles > *worst) *worst = cycles;
+	}
+
+	return (uint32_t)(total / BENCH_FIQ_REPEAT);
+}
+
+static void bench_fiq_print(const char *name, uint32_t avg, uint32_t worst){
+	uint32_t mhz = SystemCoreClock / 1000000U;
+
+	if(avg){
+		printf("%-8s %10lu %10lu %10lu %10lu\n", name, (unsigned long)avg, (unsigned long)(avg * 1000U / mhz), (unsigned long)worst, (unsigned long)(worst * 1000U / mhz));
+	}else{
+		printf("%-8s timeout\n", name);
+	}
+}
+
+void bench_fiq(void){
+	uint32_t irq_avg, irq_worst;
+	uint32_t fiq_avg, fiq_worst;
+
+	tru_pmu_ccnt_enable();
+	printf("FIQ benchmark, SGI to handler latency (average of %u)\n", (unsigned int)BENCH_FIQ_REPEAT);
+
+	// Through IRQ_Handler
+	tru_ipi_set_handler(BENCH_FIQ_SGI, bench_fiq_handler);
+	tru_ipi_enable(BENCH_FIQ_SGI);
+	irq_avg = bench_fiq_run(&irq_worst);
+	tru_ipi_disable(BENCH_FIQ_SGI);
+	tru_ipi_set_handler(BENCH_FIQ_SGI, NULL);
+
+	// Through FIQ_Handler
+	tru_fiq_init(BENCH_FIQ_SGI, bench_fiq_handler);
+	tru_fiq_enable();
+	fiq_avg = bench_fiq_run(&fiq_worst);
+	tru_fiq_exit();
+
+	printf("%-8s %10s %10s %10s %10s\n", "path", "avg cyc", "avg ns", "worst cyc", "worst ns");
+	bench_fiq_print("irq", irq_avg, irq_worst);
+	bench_fiq_print("fiq", fiq_avg, fiq_worst);
+}
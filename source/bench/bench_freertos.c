@@ -0,0 +1,151 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FreeRTOS context switch benchmark (make rtos=freertos, see
+	c5soc/tru_c5soc_freertos.h).  Starts the scheduler, so it does not
+	return.
+
+	Ping-pong: two tasks wake each other with direct task notifications, the
+	cost of one switch including the notify and wait calls.  Compare with the
+	tru_task and tru_co benchmarks.
+
+	ISR to task: an SGI stands for a peripheral IRQ.  Its handler notifies
+	the highest priority task with vTaskNotifyGiveFromISR() and yields, the
+	task records the time from the SGI send.  The idle task sleeps in the
+	tickless idle between the samples, so the latency includes the WFI exit.
+*/
+
+#include "bench.h"
+#include <stdio.h>
+
+#if defined(TRU_FREERTOS) && TRU_FREERTOS == 1U
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "c5soc/tru_c5soc_freertos.h"
+#include "irq_c5soc.h"
+#include "arm/tru_ipi.h"
+
+#define BENCH_FREERTOS_ROUNDS  10000U
+#define BENCH_FREERTOS_SAMPLES 1000U
+#define BENCH_FREERTOS_SGI     SGI11_IRQn
+#define BENCH_FREERTOS_STACK   1024U  // Words
+
+static TaskHandle_t bench_freertos_ping_h;
+static TaskHandle_t bench_freertos_pong_h;
+static TaskHandle_t bench_freertos_rx_h;
+static volatile uint32_t bench_freertos_t_irq;
+
+// Higher priority than ping, so every notify switches
+static void bench_freertos_pong(void *arg){
+	(void)arg;
+
+	while(1){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		xTaskNotifyGive(bench_freertos_ping_h);
+	}
+}
+
+static void bench_freertos_isr(void){
+	BaseType_t woken = pdFALSE;
+
+	vTaskNotifyGiveFromISR(bench_freertos_rx_h, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+static void bench_freertos_rx(void *arg){
+	uint32_t lat;
+	uint32_t lat_min = UINT32_MAX;
+	uint32_t lat_max = 0U;
+	uint64_t lat_sum = 0U;
+	uint32_t mhz = SystemCoreClock / 1000000U;
+
+	(void)arg;
+
+	for(uint32_t i = 0U; i < BENCH_FREERTOS_SAMPLES; i++){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		lat = tru_pmu_ccnt() - bench_freertos_t_irq;
+		lat_sum += lat;
+		if(lat < lat_min) lat_min = lat;
+		if(lat > lat_max) lat_max = lat;
+	}
+
+	printf("isr to task: min %lu, avg %lu, max %lu cycles (avg %lu ns)\n",
+		(unsigned long)lat_min,
+		(unsigned long)(lat_sum / BENCH_FREERTOS_SAMPLES),
+		(unsigned long)lat_max,
+		(unsigned long)(lat_sum / BENCH_FREERTOS_SAMPLES * 1000U / mhz));
+	printf("FreeRTOS benchmark done\n");
+
+	vTaskSuspendAll();
+	while(1);
+}
+
+static void bench_freertos_ping(void *arg){
+	(void)arg;
+
+	// Ping-pong
+	uint32_t t0 = tru_pmu_ccnt();
+	for(uint32_t i = 0U; i < BENCH_FREERTOS_ROUNDS; i++){
+		xTaskNotifyGive(bench_freertos_pong_h);  // Switches to pong
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	}
+	uint32_t cycles = tru_pmu_ccnt() - t0;
+	printf("ping-pong: %lu cycles per switch\n", (unsigned long)(cycles / (2U * BENCH_FREERTOS_ROUNDS)));
+	vTaskDelete(bench_freertos_pong_h);
+
+	// ISR to task, one sample per tick so the CPU is idle in between
+	for(uint32_t i = 0U; i < BENCH_FREERTOS_SAMPLES; i++){
+		vTaskDelay(1U);
+		bench_freertos_t_irq = tru_pmu_ccnt();
+		tru_ipi_send_self(BENCH_FREERTOS_SGI);
+	}
+
+	vTaskDelete(NULL);
+}
+
+void bench_freertos(void){
+	tru_pmu_ccnt_enable();
+	tru_freertos_init();
+	printf("FreeRTOS benchmark\n");
+
+	xTaskCreate(bench_freertos_ping, "ping", BENCH_FREERTOS_STACK, NULL, tskIDLE_PRIORITY + 1U, &bench_freertos_ping_h);
+	xTaskCreate(bench_freertos_pong, "pong", BENCH_FREERTOS_STACK, NULL, tskIDLE_PRIORITY + 2U, &bench_freertos_pong_h);
+	xTaskCreate(bench_freertos_rx, "rx", BENCH_FREERTOS_STACK, NULL, tskIDLE_PRIORITY + 3U, &bench_freertos_rx_h);
+
+	irq_set_group_priority(BENCH_FREERTOS_SGI, TRU_FREERTOS_IRQ_PRIORITY_DEFAULT, 0U);
+	tru_ipi_set_handler(BENCH_FREERTOS_SGI, bench_freertos_isr);
+	tru_ipi_enable(BENCH_FREERTOS_SGI);
+
+	vTaskStartScheduler();  // Does not return
+}
+
+#else
+
+void bench_freertos(void){
+	printf("FreeRTOS benchmark: build with make rtos=freertos\n");
+}
+
+#endif
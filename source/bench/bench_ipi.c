@@ -0,0 +1,142 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Round trip IPI latency between CPU0 and CPU1 (arm/tru_ipi.h).
+
+	CPU0 reads the global timer and sends an SGI to CPU1, whose handler sends
+	one straight back.  The handler on CPU0 reads the global timer again.  The
+	same is done with the mailbox, which adds the payload word hand-off.  Both
+	CPUs read the same global timer, so half the round trip is the one way
+	latency.
+*/
+
+#include "bench.h"
+#include "arm/tru_ipi.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include <stdio.h>
+#include <stddef.h>
+
+#define BENCH_IPI_SGI     SGI0_IRQn
+#define BENCH_IPI_REPEAT  1000U
+#define BENCH_IPI_TIMEOUT 10000000UL
+
+static volatile uint32_t bench_ipi_done;
+static volatile uint64_t bench_ipi_t1;
+
+// Runs on both CPUs
+static void bench_ipi_isr(void){
+	if(tru_cpu_id() == 1U){
+		tru_ipi_send(BENCH_IPI_SGI, 1U << 0U);  // Reply
+	}else{
+		bench_ipi_t1 = bench_now();
+		bench_ipi_done = 1U;
+	}
+}
+
+// Runs on both CPUs
+static void bench_ipi_mbox_handler(uint32_t from_cpu, uint32_t word){
+	if(tru_cpu_id() == 1U){
+		tru_ipi_mbox_send(from_cpu, word + 1U);  // Reply
+	}else{
+		bench_ipi_t1 = bench_now();
+		bench_ipi_done = word;
+	}
+}
+
+// CPU1: enables the SGIs on its banked GIC registers
+static void bench_ipi_core1_setup(void *arg){
+	(void)arg;
+	tru_ipi_enable(BENCH_IPI_SGI);
+	tru_ipi_mbox_init(bench_ipi_mbox_handler);
+}
+
+// CPU1: disables the SGIs on its banked GIC registers
+static void bench_ipi_core1_teardown(void *arg){
+	(void)arg;
+	tru_ipi_disable(BENCH_IPI_SGI);
+	tru_ipi_disable(TRU_IPI_MBOX_SGI);
+}
+
+// Returns the average round trip in ticks, or 0 on timeout
+static uint64_t bench_ipi_run(uint32_t use_mbox){
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_IPI_REPEAT; i++){
+		uint32_t expect = use_mbox ? i + 2U : 1U;
+		uint32_t wait = 0U;
+
+		bench_ipi_done = 0U;
+		__DSB();
+		uint64_t t0 = bench_now();
+		if(use_mbox){
+			tru_ipi_mbox_send(1U, i + 1U);
+		}else{
+			tru_ipi_send(BENCH_IPI_SGI, 1U << 1U);
+		}
+
+		while(bench_ipi_done != expect){
+			if(++wait == BENCH_IPI_TIMEOUT) return 0U;
+		}
+		total += bench_ipi_t1 - t0;
+	}
+
+	return total / BENCH_IPI_REPEAT;
+}
+
+static void bench_ipi_core1_call(void (*fn)(void *)){
+	tru_hps_smp_call_core1(fn, NULL);
+	while(tru_hps_smp_core1_busy());
+}
+
+void bench_ipi(void){
+	bench_timer_init();
+
+	printf("IPI benchmark (average of %u round trips)\n", (unsigned int)BENCH_IPI_REPEAT);
+	if(tru_hps_smp_start_core1()){
+		printf("Error: CPU1 failed to start\n");
+		return;
+	}
+
+	tru_ipi_set_handler(BENCH_IPI_SGI, bench_ipi_isr);
+	tru_ipi_enable(BENCH_IPI_SGI);
+	tru_ipi_mbox_init(bench_ipi_mbox_handler);
+	bench_ipi_core1_call(bench_ipi_core1_setup);
+
+	uint64_t sgi = bench_ipi_run(0U);
+	uint64_t mbox = bench_ipi_run(1U);
+
+	printf("%-8s %14s %14s\n", "ipi", "round trip ns", "one way ns");
+	if(sgi) printf("%-8s %14lu %14lu\n", "sgi", (unsigned long)bench_ticks_to_ns(sgi), (unsigned long)bench_ticks_to_ns(sgi / 2U));
+	else printf("%-8s timeout\n", "sgi");
+	if(mbox) printf("%-8s %14lu %14lu\n", "mailbox", (unsigned long)bench_ticks_to_ns(mbox), (unsigned long)bench_ticks_to_ns(mbox / 2U));
+	else printf("%-8s timeout\n", "mailbox");
+
+	bench_ipi_core1_call(bench_ipi_core1_teardown);
+	tru_ipi_disable(BENCH_IPI_SGI);
+	tru_ipi_disable(TRU_IPI_MBOX_SGI);
+	tru_ipi_set_handler(BENCH_IPI_SGI, NULL);
+	tru_ipi_set_handler(TRU_IPI_MBOX_SGI, NULL);
+	tru_hps_smp_stop_core1();
+}
@@ -0,0 +1,270 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Interrupt latency suite, SGI loopback and global timer compare.
+
+	Each sample timestamps the trigger, the handler entry and the return to
+	the interrupted loop:
+		- entry: trigger to the first instruction of the registered handler,
+		  so it includes the vector, IRQ_Handler and its VFP save
+		- exit: handler entry to the interrupted loop, so it includes the
+		  handler, the EOI, the VFP restore and the exception return
+	The SGI is timed with the PMU cycle counter.  The global timer compare is
+	triggered by the timer itself, so its entry is measured from the compare
+	value with the global timer (4 cycle resolution, includes reading the
+	timer in the handler).
+
+	The samples are swept over:
+		- vectors: the startup table in DDR, or a copy in OCRAM (VBAR), the
+		  OCRAM pass needs TRU_CFG_OCRAM
+		- cache: warm, or cold (L1, L2, branch predictor and I-cache cleaned
+		  and invalidated before each trigger)
+		- vfp: with TRU_LAZY_VFP the handler not using (lazy) or marked as
+		  using the VFP (eager, see arm/tru_vfp_lazy.h)
+	The caches being disabled altogether (DEBUG builds) and the VFP build
+	options are reported in the header line, compare two builds for those.
+
+	Output is one CSV line per configuration and metric, in CPU cycles:
+		irqlat,source,vectors,cache,vfp,metric,n,min,median,p99,max,hist
+	hist is the count of samples per power of two bucket, separated by ';',
+	from [0, 128) up to [16384, inf).  Lines starting with '#' are comments.
+*/
+
+#include "bench.h"
+#include "tru_cache.h"
+#include "arm/tru_ipi.h"
+#include "arm/tru_vfp_lazy.h"
+#include "c5soc/tru_c5soc_hps_ocram.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define BENCH_IRQ_LAT_SGI        SGI5_IRQn
+#define BENCH_IRQ_LAT_GTIM_IRQ   VirtualTimer_IRQn  // Cortex-A9 global timer PPI
+#define BENCH_IRQ_LAT_GTIM_DELAY 2000U              // Global timer ticks from arming the compare to the interrupt
+#define BENCH_IRQ_LAT_SAMPLES    256U
+#define BENCH_IRQ_LAT_HIST       8U               // Buckets: < 128, then doubling
+#define BENCH_IRQ_LAT_TIMEOUT    10000000UL
+
+typedef enum{
+	BENCH_IRQ_LAT_SRC_SGI,
+	BENCH_IRQ_LAT_SRC_GTIM
+}bench_irq_lat_src_t;
+
+static uint32_t bench_irq_lat_entry[BENCH_IRQ_LAT_SAMPLES];
+static uint32_t bench_irq_lat_exit[BENCH_IRQ_LAT_SAMPLES];
+static volatile uint32_t bench_irq_lat_t_entry;   // PMU cycles
+static volatile uint32_t bench_irq_lat_g_entry;   // Global timer, low word
+static volatile uint32_t bench_irq_lat_done;
+
+static void bench_irq_lat_sgi_isr(void){
+	bench_irq_lat_t_entry = tru_pmu_ccnt();
+	bench_irq_lat_done = 1U;
+}
+
+static void bench_irq_lat_gtim_isr(void){
+	bench_irq_lat_g_entry = GTIM_REG->counterl;
+	bench_irq_lat_t_entry = tru_pmu_ccnt();
+	gtim_disarm_compare();
+	gtim_clear_event();
+	bench_irq_lat_done = 1U;
+}
+
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U
+#define BENCH_IRQ_LAT_VECTORS 2U  // DDR, then OCRAM
+
+// Vector table copy in OCRAM, same as Vectors in startup_c5soc.c
+TRU_OCRAM_TEXT __attribute__((naked, aligned(32))) static void bench_irq_lat_vectors_ocram(void){
+	__ASM volatile(
+		"LDR    PC, =Reset_Handler            \n"
+		"LDR    PC, =Undef_Handler            \n"
+		"LDR    PC, =SVC_Handler              \n"
+		"LDR    PC, =PAbt_Handler             \n"
+		"LDR    PC, =DAbt_Handler             \n"
+		"NOP                                  \n"
+		"LDR    PC, =IRQ_Handler              \n"
+		"LDR    PC, =FIQ_Handler              \n"
+	);
+}
+#else
+#define BENCH_IRQ_LAT_VECTORS 1U  // DDR only, without the OCRAM a copy would also be in DDR
+#endif
+
+// Clean and invalidate all caches and the branch predictor
+static void bench_irq_lat_flush(void){
+	L1C_CleanInvalidateDCacheAll();
+	if(tru_l2_is_enabled()) L2C_CleanInvAllByWay();
+	__set_ICIALLU(0);
+	__set_BPIALL(0);
+	__DSB();
+	__ISB();
+}
+
+// Takes one sample, returns false on timeout
+static bool bench_irq_lat_sample(bench_irq_lat_src_t src, bool cold, uint32_t *entry, uint32_t *exit){
+	uint32_t wait = 0U;
+	uint32_t t_trig = 0U;
+	uint32_t g_trig = 0U;
+
+	if(cold) bench_irq_lat_flush();
+	bench_irq_lat_done = 0U;
+	__DSB();
+
+	if(src == BENCH_IRQ_LAT_SRC_SGI){
+		t_trig = tru_pmu_ccnt();
+		tru_ipi_send_self(BENCH_IRQ_LAT_SGI);
+	}else{
+		__disable_irq();  // Arm the compare without being interrupted
+		uint64_t compare = gtim_get_counter() + BENCH_IRQ_LAT_GTIM_DELAY;
+		g_trig = (uint32_t)compare;
+		gtim_arm_compare(compare);
+		__enable_irq();
+	}
+
+	while(!bench_irq_lat_done){
+		if(++wait == BENCH_IRQ_LAT_TIMEOUT) return false;
+	}
+	uint32_t t_ret = tru_pmu_ccnt();
+
+	if(src == BENCH_IRQ_LAT_SRC_SGI){
+		*entry = bench_irq_lat_t_entry - t_trig;
+	}else{
+		*entry = (bench_irq_lat_g_entry - g_trig) * 4U;  // The global timer runs at 1/4 of the CPU clock
+	}
+	*exit = t_ret - bench_irq_lat_t_entry;
+
+	return true;
+}
+
+static int bench_irq_lat_cmp(const void *a, const void *b){
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void bench_irq_lat_print(const char *cfg, const char *metric, uint32_t *samples){
+	uint32_t hist[BENCH_IRQ_LAT_HIST] = { 0U };
+
+	qsort(samples, BENCH_IRQ_LAT_SAMPLES, sizeof(samples[0]), bench_irq_lat_cmp);
+	for(uint32_t i = 0U; i < BENCH_IRQ_LAT_SAMPLES; i++){
+		uint32_t b = 0U;
+
+		while(b < BENCH_IRQ_LAT_HIST - 1U && samples[i] >= (128UL << b)) b++;
+		hist[b]++;
+	}
+
+	printf("irqlat,%s,%s,%u,%lu,%lu,%lu,%lu,",
+		cfg,
+		metric,
+		(unsigned int)BENCH_IRQ_LAT_SAMPLES,
+		(unsigned long)samples[0],
+		(unsigned long)samples[BENCH_IRQ_LAT_SAMPLES / 2U],
+		(unsigned long)samples[BENCH_IRQ_LAT_SAMPLES * 99U / 100U],
+		(unsigned long)samples[BENCH_IRQ_LAT_SAMPLES - 1U]);
+	for(uint32_t b = 0U; b < BENCH_IRQ_LAT_HIST; b++){
+		printf(b ? ";%lu" : "%lu", (unsigned long)hist[b]);
+	}
+	printf("\n");
+}
+
+static void bench_irq_lat_run(bench_irq_lat_src_t src, const char *vectors, bool cold, const char *vfp){
+	char cfg[48];
+
+	snprintf(cfg, sizeof(cfg), "%s,%s,%s,%s", src == BENCH_IRQ_LAT_SRC_SGI ? "sgi" : "gtim", vectors, cold ? "cold" : "warm", vfp);
+	for(uint32_t i = 0U; i < BENCH_IRQ_LAT_SAMPLES; i++){
+		if(!bench_irq_lat_sample(src, cold, &bench_irq_lat_entry[i], &bench_irq_lat_exit[i])){
+			printf("# %s timeout\n", cfg);
+			return;
+		}
+	}
+
+	bench_irq_lat_print(cfg, "entry", bench_irq_lat_entry);
+	bench_irq_lat_print(cfg, "exit", bench_irq_lat_exit);
+}
+
+static void bench_irq_lat_set_vfp(bool eager){
+#if TRU_VFP_LAZY_ENABLED == 1U
+	tru_vfp_lazy_set_irq(BENCH_IRQ_LAT_SGI, eager);
+	tru_vfp_lazy_set_irq(BENCH_IRQ_LAT_GTIM_IRQ, eager);
+#else
+	(void)eager;
+#endif
+}
+
+void bench_irq_lat(void){
+	uint32_t vbar = __get_VBAR();
+#if TRU_VFP_LAZY_ENABLED == 1U
+	static const char *vfp_modes[] = { "lazy", "eager" };
+#elif defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+	static const char *vfp_modes[] = { "full" };
+#else
+	static const char *vfp_modes[] = { "none" };
+#endif
+
+	bench_timer_init();
+	tru_pmu_ccnt_enable();
+
+	printf("# irqlat cpu_hz=%lu unit=cycles l1=%s l2=%s samples=%u\n",
+		(unsigned long)SystemCoreClock,
+		(__get_SCTLR() & SCTLR_C_Msk) ? "on" : "off",
+		tru_l2_is_enabled() ? "on" : "off",
+		(unsigned int)BENCH_IRQ_LAT_SAMPLES);
+#if BENCH_IRQ_LAT_VECTORS == 1U
+	printf("# irqlat vectors=ocram skipped, set TRU_CFG_OCRAM to 1U\n");
+#endif
+	printf("# irqlat,source,vectors,cache,vfp,metric,n,min,median,p99,max,hist\n");
+
+	IRQ_SetHandler(BENCH_IRQ_LAT_SGI, bench_irq_lat_sgi_isr);
+	IRQ_SetHandler(BENCH_IRQ_LAT_GTIM_IRQ, bench_irq_lat_gtim_isr);
+	IRQ_Enable(BENCH_IRQ_LAT_SGI);
+	IRQ_Enable(BENCH_IRQ_LAT_GTIM_IRQ);
+
+	for(uint32_t v = 0U; v < BENCH_IRQ_LAT_VECTORS; v++){
+		const char *vectors = v ? "ocram" : "ddr";
+
+#if BENCH_IRQ_LAT_VECTORS == 2U
+		__set_VBAR(v ? (uint32_t)bench_irq_lat_vectors_ocram : vbar);
+#else
+		__set_VBAR(vbar);
+#endif
+		__ISB();
+		for(uint32_t c = 0U; c < 2U; c++){
+			for(uint32_t f = 0U; f < sizeof(vfp_modes) / sizeof(vfp_modes[0]); f++){
+				bench_irq_lat_set_vfp(f == 1U);
+				bench_irq_lat_run(BENCH_IRQ_LAT_SRC_SGI, vectors, c == 1U, vfp_modes[f]);
+				bench_irq_lat_run(BENCH_IRQ_LAT_SRC_GTIM, vectors, c == 1U, vfp_modes[f]);
+			}
+		}
+	}
+
+	__set_VBAR(vbar);
+	__ISB();
+	bench_irq_lat_set_vfp(false);
+	IRQ_Disable(BENCH_IRQ_LAT_SGI);
+	IRQ_Disable(BENCH_IRQ_LAT_GTIM_IRQ);
+	IRQ_SetHandler(BENCH_IRQ_LAT_SGI, NULL);
+	IRQ_SetHandler(BENCH_IRQ_LAT_GTIM_IRQ, NULL);
+}
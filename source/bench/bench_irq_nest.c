@@ -0,0 +1,139 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Latency of a high priority IRQ that arrives during a long low priority
+	handler (TRU_NESTED_IRQ, see irq_c5soc.c).
+
+	The low priority SGI handler spins for BENCH_IRQ_NEST_SPIN_US and half way
+	through sends the high priority SGI to itself.  With the nested dispatcher
+	the high priority handler preempts it, otherwise it waits until the low
+	priority handler has returned.  The latency is from the send to the entry of
+	the high priority handler.
+*/
+
+#include "bench.h"
+#include "arm/tru_ipi.h"
+#include "irq_c5soc.h"
+#include <stdio.h>
+#include <stddef.h>
+
+#define BENCH_IRQ_NEST_LOW       SGI1_IRQn
+#define BENCH_IRQ_NEST_HIGH      SGI2_IRQn
+#define BENCH_IRQ_NEST_LOW_PRI   0xA0U  // Lower priority = a higher value
+#define BENCH_IRQ_NEST_HIGH_PRI  0x40U
+#define BENCH_IRQ_NEST_SPIN_US   100U
+#define BENCH_IRQ_NEST_REPEAT    100U
+#define BENCH_IRQ_NEST_TIMEOUT   10000000UL
+
+static volatile uint64_t bench_irq_nest_t_send;
+static volatile uint64_t bench_irq_nest_t_high;
+static volatile uint64_t bench_irq_nest_t_low_end;
+static volatile uint32_t bench_irq_nest_level;
+static volatile uint32_t bench_irq_nest_done;
+
+static void bench_irq_nest_low_isr(void){
+	uint64_t spin = (uint64_t)BENCH_IRQ_NEST_SPIN_US * (BENCH_TIMER_HZ / 1000000U);
+	uint64_t t0 = bench_now();
+	uint32_t sent = 0U;
+	uint64_t t;
+
+	do{
+		t = bench_now();
+		if(!sent && t - t0 >= spin / 2U){
+			sent = 1U;
+			bench_irq_nest_t_send = t;
+			tru_ipi_send_self(BENCH_IRQ_NEST_HIGH);
+		}
+	}while(t - t0 < spin);
+
+	bench_irq_nest_t_low_end = bench_now();
+	bench_irq_nest_done |= 1U;
+}
+
+static void bench_irq_nest_high_isr(void){
+	bench_irq_nest_t_high = bench_now();
+#if defined(TRU_NESTED_IRQ) && TRU_NESTED_IRQ == 1U
+	bench_irq_nest_level = irq_nest_level();
+#else
+	bench_irq_nest_level = 1U;
+#endif
+	bench_irq_nest_done |= 2U;
+}
+
+void bench_irq_nest(void){
+	uint64_t total = 0U;
+	uint64_t worst = 0U;
+	uint32_t preempted = 0U;
+	uint32_t max_level = 0U;
+
+	bench_timer_init();
+
+#if defined(TRU_NESTED_IRQ) && TRU_NESTED_IRQ == 1U
+	printf("IRQ nesting benchmark, nested dispatcher (average of %u)\n", (unsigned int)BENCH_IRQ_NEST_REPEAT);
+#else
+	printf("IRQ nesting benchmark, flat dispatcher (average of %u)\n", (unsigned int)BENCH_IRQ_NEST_REPEAT);
+#endif
+
+	tru_ipi_set_handler(BENCH_IRQ_NEST_LOW, bench_irq_nest_low_isr);
+	tru_ipi_set_handler(BENCH_IRQ_NEST_HIGH, bench_irq_nest_high_isr);
+	IRQ_SetPriority(BENCH_IRQ_NEST_LOW, BENCH_IRQ_NEST_LOW_PRI);
+	IRQ_SetPriority(BENCH_IRQ_NEST_HIGH, BENCH_IRQ_NEST_HIGH_PRI);
+	tru_ipi_enable(BENCH_IRQ_NEST_LOW);
+	tru_ipi_enable(BENCH_IRQ_NEST_HIGH);
+
+	for(uint32_t i = 0U; i < BENCH_IRQ_NEST_REPEAT; i++){
+		uint32_t wait = 0U;
+
+		bench_irq_nest_done = 0U;
+		__DSB();
+		tru_ipi_send_self(BENCH_IRQ_NEST_LOW);
+		while(bench_irq_nest_done != 3U){
+			if(++wait == BENCH_IRQ_NEST_TIMEOUT){
+				printf("Error: timeout\n");
+				goto cleanup;
+			}
+		}
+
+		uint64_t latency = bench_irq_nest_t_high - bench_irq_nest_t_send;
+		total += latency;
+		if(latency > worst) worst = latency;
+		if(bench_irq_nest_t_high < bench_irq_nest_t_low_end) preempted++;
+		if(bench_irq_nest_level > max_level) max_level = bench_irq_nest_level;
+	}
+
+	printf("%-10s %10s %10s %10s %10s\n", "spin us", "avg ns", "worst ns", "preempted", "max depth");
+	printf("%-10u %10lu %10lu %10u %10u\n",
+		(unsigned int)BENCH_IRQ_NEST_SPIN_US,
+		(unsigned long)bench_ticks_to_ns(total / BENCH_IRQ_NEST_REPEAT),
+		(unsigned long)bench_ticks_to_ns(worst),
+		(unsigned int)preempted,
+		(unsigned int)max_level);
+
+cleanup:
+	tru_ipi_disable(BENCH_IRQ_NEST_LOW);
+	tru_ipi_disable(BENCH_IRQ_NEST_HIGH);
+	tru_ipi_set_handler(BENCH_IRQ_NEST_LOW, NULL);
+	tru_ipi_set_handler(BENCH_IRQ_NEST_HIGH, NULL);
+}
@@ -0,0 +1,192 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Two-CPU lock contention benchmark.
+
+	CPU0 and CPU1 (started with tru_hps_smp_start_core1()) take the same lock
+	in a loop for a fixed time, with a short critical section and a short gap
+	between acquires.  For each CPU it reports the number of acquires and the
+	average and worst time to acquire.  Fairness is the acquires of the CPU
+	with fewer over the one with more: a ticket lock should be close to 100%,
+	a plain spinlock usually favours one CPU.  The shared counter updated in
+	the critical section must match the total, otherwise the lock is broken.
+
+	The single-CPU row is the uncontended cost.
+*/
+
+#include "bench.h"
+#include "arm/tru_atomic.h"
+#include "arm/tru_lock.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+#define BENCH_LOCK_RUN_MS       200U
+#define BENCH_LOCK_HOLD_LOOPS   20U   // Work inside the critical section
+#define BENCH_LOCK_GAP_LOOPS    20U   // Work between acquires
+#define BENCH_LOCK_DONE_TIMEOUT 100000000UL
+
+typedef struct{
+	const char *name;
+	void (*lock)(void *lock);
+	void (*unlock)(void *lock);
+	void *arg;
+}bench_lock_ops_t;
+
+typedef struct{
+	uint32_t acquires;
+	uint64_t total;
+	uint64_t max;
+}bench_lock_result_t;
+
+typedef struct{
+	const bench_lock_ops_t *ops;
+	volatile uint32_t go;
+	uint64_t end;
+	volatile uint32_t shared;  // Updated only inside the critical section
+	bench_lock_result_t result[2];
+}bench_lock_ctx_t;
+
+static tru_spinlock_t bench_lock_spin;
+static tru_ticketlock_t bench_lock_ticket;
+static volatile uint32_t bench_lock_atomic_word;
+static bench_lock_ctx_t bench_lock_ctx;
+
+static void bench_lock_spin_lock(void *lock){ tru_spin_lock(lock); }
+static void bench_lock_spin_unlock(void *lock){ tru_spin_unlock(lock); }
+static void bench_lock_ticket_lock(void *lock){ tru_ticket_lock(lock); }
+static void bench_lock_ticket_unlock(void *lock){ tru_ticket_unlock(lock); }
+
+// A CAS lock without WFE, to show what the WFE waiting saves
+static void bench_lock_cas_lock(void *lock){ while(!tru_atomic_cas(lock, 0U, 1U)); }
+static void bench_lock_cas_unlock(void *lock){ tru_atomic_store(lock, 0U); }
+
+static const bench_lock_ops_t bench_lock_ops[] = {
+	{ "cas (no wfe)", bench_lock_cas_lock, bench_lock_cas_unlock, (void *)&bench_lock_atomic_word },
+	{ "spinlock", bench_lock_spin_lock, bench_lock_spin_unlock, &bench_lock_spin },
+	{ "ticket lock", bench_lock_ticket_lock, bench_lock_ticket_unlock, &bench_lock_ticket }
+};
+
+static void bench_lock_delay(uint32_t loops){
+	for(volatile uint32_t i = 0U; i < loops; i++);
+}
+
+// Runs on both CPUs
+static void bench_lock_worker(void *arg){
+	bench_lock_ctx_t *ctx = arg;
+	const bench_lock_ops_t *ops = ctx->ops;
+	bench_lock_result_t *res = &ctx->result[tru_cpu_id()];
+
+	while(!ctx->go);
+
+	while(bench_now() < ctx->end){
+		uint64_t t0 = bench_now();
+		ops->lock(ops->arg);
+		uint64_t t = bench_now() - t0;
+
+		ctx->shared++;
+		bench_lock_delay(BENCH_LOCK_HOLD_LOOPS);
+		ops->unlock(ops->arg);
+
+		res->acquires++;
+		res->total += t;
+		if(t > res->max) res->max = t;
+
+		bench_lock_delay(BENCH_LOCK_GAP_LOOPS);
+	}
+}
+
+static void bench_lock_print(const char *name, const char *cpus, const bench_lock_result_t *res){
+	uint32_t avg = res->acquires ? bench_ticks_to_ns(res->total / res->acquires) : 0U;
+
+	printf("%-14s %-5s %10lu %10lu %10lu\n", name, cpus, (unsigned long)res->acquires, (unsigned long)avg, (unsigned long)bench_ticks_to_ns(res->max));
+}
+
+// Returns -1 if CPU1 did not finish
+static int bench_lock_run(const bench_lock_ops_t *ops, bool dual){
+	bench_lock_ctx_t *ctx = &bench_lock_ctx;
+
+	*ctx = (bench_lock_ctx_t){ .ops = ops };
+	ctx->end = bench_now() + (uint64_t)BENCH_LOCK_RUN_MS * (BENCH_TIMER_HZ / 1000U);
+	if(dual){
+		if(tru_hps_smp_call_core1(bench_lock_worker, ctx)) return -1;
+	}
+	__DMB();
+	ctx->go = 1U;
+
+	bench_lock_worker(ctx);
+
+	if(dual){
+		for(uint32_t i = 0U; tru_hps_smp_core1_busy(); i++){
+			if(i == BENCH_LOCK_DONE_TIMEOUT) return -1;
+		}
+	}
+	__DMB();
+
+	return 0;
+}
+
+void bench_lock(void){
+	bench_timer_init();
+	tru_spin_init(&bench_lock_spin);
+	tru_ticket_init(&bench_lock_ticket);
+
+	printf("Lock benchmark (%u ms per lock, acquire times in ns)\n", (unsigned int)BENCH_LOCK_RUN_MS);
+	if(tru_hps_smp_start_core1()){
+		printf("Error: CPU1 failed to start\n");
+		return;
+	}
+
+	printf("%-14s %-5s %10s %10s %10s\n", "lock", "cpu", "acquires", "avg", "max");
+	for(uint32_t i = 0U; i < sizeof(bench_lock_ops) / sizeof(bench_lock_ops[0]); i++){
+		const bench_lock_ops_t *ops = &bench_lock_ops[i];
+		bench_lock_result_t *res = bench_lock_ctx.result;
+
+		// Uncontended
+		bench_lock_run(ops, false);
+		bench_lock_print(ops->name, "0", &res[0]);
+
+		// Contended
+		if(bench_lock_run(ops, true)){
+			printf("Error: CPU1 did not respond\n");
+			break;
+		}
+		uint32_t lo = res[0].acquires < res[1].acquires ? res[0].acquires : res[1].acquires;
+		uint32_t hi = res[0].acquires < res[1].acquires ? res[1].acquires : res[0].acquires;
+
+		bool ok = bench_lock_ctx.shared == res[0].acquires + res[1].acquires;
+
+		bench_lock_print(ops->name, "0+1:0", &res[0]);
+		bench_lock_print(ops->name, "0+1:1", &res[1]);
+		printf("%-14s fairness: %lu%%%s\n", "", (unsigned long)(hi ? (uint64_t)lo * 100U / hi : 0U), ok ? "" : ", error: shared counter mismatch");
+	}
+
+#if TRU_LOCK_STATS == 1U
+	printf("spinlock stats: %lu acquires, %lu contended, %lu waits\n", (unsigned long)bench_lock_spin.stats.acquires, (unsigned long)bench_lock_spin.stats.contended, (unsigned long)bench_lock_spin.stats.waits);
+	printf("ticket lock stats: %lu acquires, %lu contended, %lu waits\n", (unsigned long)bench_lock_ticket.stats.acquires, (unsigned long)bench_lock_ticket.stats.contended, (unsigned long)bench_lock_ticket.stats.waits);
+#endif
+
+	tru_hps_smp_stop_core1();
+}
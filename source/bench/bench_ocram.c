@@ -0,0 +1,131 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	OCRAM vs. DDR placement of an ISR and a lookup table.
+
+	The ISR latency is the time from sending a SGI to self until the ISR has
+	taken its timestamp.  The lookup table test does pseudo random reads from
+	a 16kB table.  Each is run with cold caches (all caches cleaned and
+	invalidated before each run) and warm caches.
+*/
+
+#include "bench.h"
+#include "tru_cache.h"
+#include "c5soc/tru_c5soc_hps_ocram.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+#define BENCH_OCRAM_LUT_LEN 4096U  // 16kB table
+#define BENCH_OCRAM_LOOKUPS 1024U
+#define BENCH_OCRAM_REPEAT  32U
+#define BENCH_OCRAM_SGI     SGI15_IRQn
+
+static uint32_t bench_ocram_lut_ddr[BENCH_OCRAM_LUT_LEN] __attribute__((aligned(CACHELINE_SIZE)));
+TRU_OCRAM_BSS static uint32_t bench_ocram_lut_ocram[BENCH_OCRAM_LUT_LEN] __attribute__((aligned(CACHELINE_SIZE)));
+
+static volatile uint64_t bench_ocram_isr_ts;  // Timestamp taken by the ISR
+static volatile uint32_t bench_ocram_sink;
+
+static void bench_ocram_isr_ddr(void){
+	bench_ocram_isr_ts = bench_now();
+}
+
+TRU_OCRAM_TEXT static void bench_ocram_isr_ocram(void){
+	bench_ocram_isr_ts = bench_now();
+}
+
+// Clean and invalidate all caches and the branch predictor
+static void bench_ocram_flush(void){
+	L1C_CleanInvalidateDCacheAll();
+	if(tru_l2_is_enabled()) L2C_CleanInvAllByWay();
+	__set_ICIALLU(0);
+	__set_BPIALL(0);
+	__DSB();
+	__ISB();
+}
+
+static uint32_t bench_ocram_irq_latency(IRQHandler_t isr, bool cold){
+	uint64_t total = 0U;
+
+	IRQ_SetHandler(BENCH_OCRAM_SGI, isr);
+	IRQ_Enable(BENCH_OCRAM_SGI);
+
+	for(uint32_t i = 0U; i < BENCH_OCRAM_REPEAT; i++){
+		if(cold) bench_ocram_flush();
+		bench_ocram_isr_ts = 0U;
+
+		uint64_t t0 = bench_now();
+		GIC_SendSGI(BENCH_OCRAM_SGI, 0U, 2U);  // Filter 2 = send to self
+		while(bench_ocram_isr_ts == 0U);
+
+		total += bench_ocram_isr_ts - t0;
+	}
+
+	IRQ_Disable(BENCH_OCRAM_SGI);
+	IRQ_SetHandler(BENCH_OCRAM_SGI, NULL);
+
+	return bench_ticks_to_ns(total / BENCH_OCRAM_REPEAT);
+}
+
+static uint32_t bench_ocram_lut(const uint32_t *lut, bool cold){
+	uint64_t total = 0U;
+
+	for(uint32_t i = 0U; i < BENCH_OCRAM_REPEAT; i++){
+		uint32_t seed = i;
+		uint32_t sum = 0U;
+
+		if(cold) bench_ocram_flush();
+
+		uint64_t t0 = bench_now();
+		for(uint32_t j = 0U; j < BENCH_OCRAM_LOOKUPS; j++){
+			seed = seed * 1103515245U + 12345U;
+			sum += lut[(seed >> 16U) & (BENCH_OCRAM_LUT_LEN - 1U)];
+		}
+		total += bench_now() - t0;
+
+		bench_ocram_sink = sum;
+	}
+
+	return bench_ticks_to_ns(total / BENCH_OCRAM_REPEAT);
+}
+
+void bench_ocram(void){
+	bench_timer_init();
+
+	for(uint32_t i = 0U; i < BENCH_OCRAM_LUT_LEN; i++){
+		bench_ocram_lut_ddr[i] = i * 2654435761U;
+		bench_ocram_lut_ocram[i] = i * 2654435761U;
+	}
+
+	printf("OCRAM benchmark (average ns of %u runs)\n", (unsigned int)BENCH_OCRAM_REPEAT);
+	#if !defined(TRU_OCRAM) || TRU_OCRAM != 1U
+		printf("OCRAM placement is off (TRU_CFG_OCRAM), both columns run from DDR\n");
+	#endif
+	printf("%-26s %10s %10s\n", "", "ddr", "ocram");
+	printf("%-26s %10lu %10lu\n", "ISR latency, cold", (unsigned long)bench_ocram_irq_latency(bench_ocram_isr_ddr, true), (unsigned long)bench_ocram_irq_latency(bench_ocram_isr_ocram, true));
+	printf("%-26s %10lu %10lu\n", "ISR latency, warm", (unsigned long)bench_ocram_irq_latency(bench_ocram_isr_ddr, false), (unsigned long)bench_ocram_irq_latency(bench_ocram_isr_ocram, false));
+	printf("%-26s %10lu %10lu\n", "1024 LUT lookups, cold", (unsigned long)bench_ocram_lut(bench_ocram_lut_ddr, true), (unsigned long)bench_ocram_lut(bench_ocram_lut_ocram, true));
+	printf("%-26s %10lu %10lu\n", "1024 LUT lookups, warm", (unsigned long)bench_ocram_lut(bench_ocram_lut_ddr, false), (unsigned long)bench_ocram_lut(bench_ocram_lut_ocram, false));
+}
@@ -0,0 +1,176 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Two-CPU queue benchmark for tru_queue.h.
+
+	Throughput: CPU1 pushes a sequence of words that CPU0 pops and checks,
+	one element at a time and in batches of BENCH_QUEUE_BATCH.
+
+	Latency: CPU0 pushes a timestamp to CPU1, which pushes it straight back
+	on a second queue.  Half the round trip is the one way latency.
+*/
+
+#include "bench.h"
+#include "tru_queue.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include <stdio.h>
+#include <stdbool.h>
+
+#define BENCH_QUEUE_LEN     256U
+#define BENCH_QUEUE_ITEMS   1000000U
+#define BENCH_QUEUE_BATCH   16U
+#define BENCH_QUEUE_PINGS   10000U
+
+typedef enum{
+	BENCH_QUEUE_SPSC,
+	BENCH_QUEUE_MPMC
+}bench_queue_type_t;
+
+typedef struct{
+	bench_queue_type_t type;
+	uint32_t batch;
+}bench_queue_cfg_t;
+
+static tru_spsc_t bench_queue_spsc[2];
+static tru_mpmc_t bench_queue_mpmc[2];
+static uint32_t bench_queue_spsc_buf[2][BENCH_QUEUE_LEN];
+static uint32_t bench_queue_mpmc_buf[2][BENCH_QUEUE_LEN * TRU_MPMC_CELL_SIZE(sizeof(uint32_t)) / 4U];
+static bench_queue_cfg_t bench_queue_cfg;
+
+static void bench_queue_init(bench_queue_type_t type){
+	for(uint32_t i = 0U; i < 2U; i++){
+		if(type == BENCH_QUEUE_SPSC){
+			tru_spsc_init(&bench_queue_spsc[i], bench_queue_spsc_buf[i], sizeof(uint32_t), BENCH_QUEUE_LEN);
+		}else{
+			tru_mpmc_init(&bench_queue_mpmc[i], bench_queue_mpmc_buf[i], sizeof(uint32_t), BENCH_QUEUE_LEN);
+		}
+	}
+}
+
+static inline uint32_t bench_queue_push(bench_queue_type_t type, uint32_t q, const uint32_t *data, uint32_t n){
+	return type == BENCH_QUEUE_SPSC ? tru_spsc_push_n(&bench_queue_spsc[q], data, n) : tru_mpmc_push_n(&bench_queue_mpmc[q], data, n);
+}
+
+static inline uint32_t bench_queue_pop(bench_queue_type_t type, uint32_t q, uint32_t *data, uint32_t n){
+	return type == BENCH_QUEUE_SPSC ? tru_spsc_pop_n(&bench_queue_spsc[q], data, n) : tru_mpmc_pop_n(&bench_queue_mpmc[q], data, n);
+}
+
+// CPU1: produces BENCH_QUEUE_ITEMS words on queue 0
+static void bench_queue_producer(void *arg){
+	const bench_queue_cfg_t *cfg = arg;
+	uint32_t data[BENCH_QUEUE_BATCH];
+	uint32_t seq = 0U;
+
+	while(seq < BENCH_QUEUE_ITEMS){
+		uint32_t n = BENCH_QUEUE_ITEMS - seq < cfg->batch ? BENCH_QUEUE_ITEMS - seq : cfg->batch;
+
+		for(uint32_t i = 0U; i < n; i++) data[i] = seq + i;
+		seq += bench_queue_push(cfg->type, 0U, data, n);
+	}
+}
+
+// CPU1: echoes BENCH_QUEUE_PINGS words from queue 0 to queue 1
+static void bench_queue_echo(void *arg){
+	const bench_queue_cfg_t *cfg = arg;
+	uint32_t val;
+
+	for(uint32_t i = 0U; i < BENCH_QUEUE_PINGS; i++){
+		while(!bench_queue_pop(cfg->type, 0U, &val, 1U));
+		while(!bench_queue_push(cfg->type, 1U, &val, 1U));
+	}
+}
+
+static void bench_queue_wait_core1(void){
+	while(tru_hps_smp_core1_busy());
+	__DMB();
+}
+
+// Returns the consumed items per second, or 0 on a sequence error
+static uint32_t bench_queue_throughput(bench_queue_type_t type, uint32_t batch){
+	uint32_t data[BENCH_QUEUE_BATCH];
+	uint32_t expect = 0U;
+	bool ok = true;
+
+	bench_queue_init(type);
+	bench_queue_cfg = (bench_queue_cfg_t){ .type = type, .batch = batch };
+	if(tru_hps_smp_call_core1(bench_queue_producer, &bench_queue_cfg)) return 0U;
+
+	uint64_t t0 = bench_now();
+	while(expect < BENCH_QUEUE_ITEMS){
+		uint32_t n = bench_queue_pop(type, 0U, data, batch);
+
+		for(uint32_t i = 0U; i < n; i++){
+			if(data[i] != expect++) ok = false;
+		}
+	}
+	uint64_t t = bench_now() - t0;
+	bench_queue_wait_core1();
+
+	return ok ? (uint32_t)((uint64_t)BENCH_QUEUE_ITEMS * BENCH_TIMER_HZ / t) : 0U;
+}
+
+// Returns the average one way latency in ns
+static uint32_t bench_queue_latency(bench_queue_type_t type){
+	uint64_t total = 0U;
+
+	bench_queue_init(type);
+	bench_queue_cfg = (bench_queue_cfg_t){ .type = type, .batch = 1U };
+	if(tru_hps_smp_call_core1(bench_queue_echo, &bench_queue_cfg)) return 0U;
+
+	for(uint32_t i = 0U; i < BENCH_QUEUE_PINGS; i++){
+		uint32_t val = i;
+		uint64_t t0 = bench_now();
+
+		while(!bench_queue_push(type, 0U, &val, 1U));
+		while(!bench_queue_pop(type, 1U, &val, 1U));
+		total += bench_now() - t0;
+	}
+	bench_queue_wait_core1();
+
+	return bench_ticks_to_ns(total / BENCH_QUEUE_PINGS / 2U);
+}
+
+void bench_queue(void){
+	static const char *const names[] = { "spsc", "mpmc" };
+
+	bench_timer_init();
+
+	printf("Queue benchmark (CPU1 to CPU0, %u word elements)\n", (unsigned int)BENCH_QUEUE_ITEMS);
+	if(tru_hps_smp_start_core1()){
+		printf("Error: CPU1 failed to start\n");
+		return;
+	}
+
+	printf("%-6s %14s %14s %12s\n", "queue", "items/s", "batch items/s", "latency ns");
+	for(uint32_t type = BENCH_QUEUE_SPSC; type <= BENCH_QUEUE_MPMC; type++){
+		uint32_t single = bench_queue_throughput(type, 1U);
+		uint32_t batched = bench_queue_throughput(type, BENCH_QUEUE_BATCH);
+		uint32_t latency = bench_queue_latency(type);
+
+		printf("%-6s %14lu %14lu %12lu\n", names[type], (unsigned long)single, (unsigned long)batched, (unsigned long)latency);
+	}
+
+	tru_hps_smp_stop_core1();
+}
@@ -0,0 +1,116 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Parallel-for speedup on two CPUs (tru_task.h).
+
+	Each kernel is timed on CPU0 alone and then with tru_parallel_for() on
+	both CPUs, and the results are compared.  The memory-bound kernel sums a
+	buffer much larger than the L2 cache, so the speedup is limited by the
+	SDRAM bandwidth.  The compute-bound kernel runs an integer hash per
+	element from registers and should get close to 2x.
+*/
+
+#include "bench.h"
+#include "tru_task.h"
+#include "arm/tru_atomic.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include <stdio.h>
+
+#define BENCH_TASK_MEM_WORDS   (4U * 1024U * 1024U)  // 16MB
+#define BENCH_TASK_CPU_ITEMS   65536U
+#define BENCH_TASK_CPU_ROUNDS  64U
+#define BENCH_TASK_CHUNKS      64U  // Grain is the range divided by this
+
+typedef struct{
+	const uint32_t *buf;
+	volatile uint32_t result;
+}bench_task_ctx_t;
+
+static uint32_t bench_task_buf[BENCH_TASK_MEM_WORDS];
+
+static void bench_task_mem_kernel(uint32_t begin, uint32_t end, void *arg){
+	bench_task_ctx_t *ctx = arg;
+	uint32_t sum = 0U;
+
+	for(uint32_t i = begin; i < end; i++) sum += ctx->buf[i];
+	tru_atomic_add(&ctx->result, sum);
+}
+
+static void bench_task_cpu_kernel(uint32_t begin, uint32_t end, void *arg){
+	bench_task_ctx_t *ctx = arg;
+	uint32_t sum = 0U;
+
+	for(uint32_t i = begin; i < end; i++){
+		uint32_t x = i + 1U;
+
+		// xorshift32 rounds
+		for(uint32_t r = 0U; r < BENCH_TASK_CPU_ROUNDS; r++){
+			x ^= x << 13U;
+			x ^= x >> 17U;
+			x ^= x << 5U;
+		}
+		sum += x;
+	}
+	tru_atomic_add(&ctx->result, sum);
+}
+
+static void bench_task_run(const char *name, tru_task_fn_t fn, uint32_t items){
+	bench_task_ctx_t ctx = { .buf = bench_task_buf };
+	uint32_t serial_result;
+	uint64_t t0;
+
+	t0 = bench_now();
+	fn(0U, items, &ctx);
+	uint64_t serial = bench_now() - t0;
+	serial_result = ctx.result;
+
+	ctx.result = 0U;
+	t0 = bench_now();
+	tru_parallel_for(0U, items, items / BENCH_TASK_CHUNKS, fn, &ctx);
+	uint64_t parallel = bench_now() - t0;
+
+	uint32_t speedup = (uint32_t)(serial * 100U / parallel);
+	printf("%-14s %12lu %12lu %5lu.%.2lux%s\n", name, (unsigned long)(serial / (BENCH_TIMER_HZ / 1000000U)), (unsigned long)(parallel / (BENCH_TIMER_HZ / 1000000U)),
+		(unsigned long)(speedup / 100U), (unsigned long)(speedup % 100U), ctx.result == serial_result ? "" : "  error: result mismatch");
+}
+
+void bench_task(void){
+	bench_timer_init();
+
+	for(uint32_t i = 0U; i < BENCH_TASK_MEM_WORDS; i++) bench_task_buf[i] = i;
+
+	printf("Parallel-for benchmark (times in us)\n");
+	if(tru_task_init()){
+		printf("Error: CPU1 failed to start\n");
+		return;
+	}
+
+	printf("%-14s %12s %12s %9s\n", "kernel", "1 cpu", "2 cpus", "speedup");
+	bench_task_run("memory-bound", bench_task_mem_kernel, BENCH_TASK_MEM_WORDS);
+	bench_task_run("compute-bound", bench_task_cpu_kernel, BENCH_TASK_CPU_ITEMS);
+
+	tru_task_exit();
+	tru_hps_smp_stop_core1();
+}
@@ -0,0 +1,222 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Preemptive thread kernel (tru_thread.h), needs TRU_CFG_THREAD == 1U.
+
+	Yield: two threads of the same priority yield to each other, the cost of
+	one switch through SVC.
+
+	Ping-pong: a low priority thread posts a semaphore, which preempts it
+	for a high priority thread that posts back and waits again.  Two
+	switches per round, including the semaphore calls.
+
+	IRQ to thread: an SGI stands for a peripheral IRQ, its handler posts a
+	semaphore and the high priority thread switches in on the way out of
+	IRQ_Handler.  The CPU is idle in WFI between the samples.
+
+	SGI reschedule: a low priority thread posts a semaphore with the IRQ
+	masked, so the kernel sends itself TRU_THREAD_SGI (SGI12) and the high
+	priority thread switches in when the IRQ is unmasked, the same path as
+	a wake up from the other CPU.
+
+	The target for one switch is under 1 us (800 cycles at 800 MHz), each
+	result is printed in cycles and us against it.
+*/
+
+#include "bench.h"
+#include <stdio.h>
+
+#if defined(TRU_THREAD) && TRU_THREAD == 1U
+
+#include "tru_thread.h"
+#include "arm/tru_ipi.h"
+
+#define BENCH_THREAD_YIELDS  10000U
+#define BENCH_THREAD_ROUNDS  10000U
+#define BENCH_THREAD_SAMPLES 1000U
+#define BENCH_THREAD_SGI     SGI13_IRQn
+#define BENCH_THREAD_STACK   4096U
+
+typedef struct{
+	tru_thread_sem_t ping;
+	tru_thread_sem_t pong;
+	tru_thread_sem_t irq;
+	volatile uint32_t t_irq;
+	uint32_t cycles;
+	uint32_t lat_min;
+	uint32_t lat_max;
+	uint64_t lat_sum;
+}bench_thread_t;
+
+static bench_thread_t bench_thread_data;
+static uint64_t bench_thread_stack[2][BENCH_THREAD_STACK / sizeof(uint64_t)];
+static tru_thread_t bench_thread_t0, bench_thread_t1;
+
+static void bench_thread_yield_fn(void *ctx){
+	bench_thread_t *b = ctx;
+	uint32_t t0 = tru_pmu_ccnt();
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_YIELDS; i++){
+		tru_thread_yield();
+	}
+	if(tru_thread_self() == &bench_thread_t0) b->cycles = tru_pmu_ccnt() - t0;
+}
+
+static void bench_thread_ping_fn(void *ctx){
+	bench_thread_t *b = ctx;
+	uint32_t t0 = tru_pmu_ccnt();
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_ROUNDS; i++){
+		tru_thread_sem_post(&b->pong);  // Switches to the pong thread
+		tru_thread_sem_wait(&b->ping);
+	}
+	b->cycles = tru_pmu_ccnt() - t0;
+}
+
+static void bench_thread_pong_fn(void *ctx){
+	bench_thread_t *b = ctx;
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_ROUNDS; i++){
+		tru_thread_sem_wait(&b->pong);
+		tru_thread_sem_post(&b->ping);
+	}
+}
+
+static void bench_thread_isr(void){
+	tru_thread_sem_post(&bench_thread_data.irq);
+}
+
+static void bench_thread_rx_fn(void *ctx){
+	bench_thread_t *b = ctx;
+	uint32_t lat;
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_SAMPLES; i++){
+		tru_thread_sem_wait(&b->irq);
+		lat = tru_pmu_ccnt() - b->t_irq;
+		b->lat_sum += lat;
+		if(lat < b->lat_min) b->lat_min = lat;
+		if(lat > b->lat_max) b->lat_max = lat;
+	}
+}
+
+static void bench_thread_sgi_source_fn(void *ctx){
+	bench_thread_t *b = ctx;
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_SAMPLES; i++){
+		__disable_irq();
+		b->t_irq = tru_pmu_ccnt();
+		tru_thread_sem_post(&b->irq);  // Sends TRU_THREAD_SGI, taken when the IRQ is unmasked
+		__enable_irq();
+	}
+}
+
+static void bench_thread_source_fn(void *ctx){
+	bench_thread_t *b = ctx;
+
+	for(uint32_t i = 0U; i < BENCH_THREAD_SAMPLES; i++){
+		tru_thread_sleep(tru_time_us_to_ticks(20U));
+		b->t_irq = tru_pmu_ccnt();
+		tru_ipi_send_self(BENCH_THREAD_SGI);
+	}
+}
+
+// Prints cycles as us with two decimals, and whether they are under the 1 us target
+static void bench_thread_print_cycles(uint32_t cycles){
+	uint32_t mhz = SystemCoreClock / 1000000U;
+	uint32_t us100 = (uint32_t)((uint64_t)cycles * 100U / mhz);
+
+	printf("%lu cycles (%lu.%02lu us, %s 1 us)", (unsigned long)cycles, (unsigned long)(us100 / 100U), (unsigned long)(us100 % 100U), (cycles < mhz) ? "under" : "over");
+}
+
+static void bench_thread_print(const char *name, uint32_t cycles, uint32_t switches){
+	printf("%s: ", name);
+	bench_thread_print_cycles(cycles / switches);
+	printf(" per switch\n");
+}
+
+static void bench_thread_lat_reset(bench_thread_t *b){
+	tru_thread_sem_init(&b->irq, 0U);
+	b->lat_min = UINT32_MAX;
+	b->lat_max = 0U;
+	b->lat_sum = 0U;
+}
+
+static void bench_thread_lat_print(const char *name, const bench_thread_t *b){
+	printf("%s: min ", name);
+	bench_thread_print_cycles(b->lat_min);
+	printf(", avg ");
+	bench_thread_print_cycles((uint32_t)(b->lat_sum / BENCH_THREAD_SAMPLES));
+	printf(", max ");
+	bench_thread_print_cycles(b->lat_max);
+	printf("\n");
+}
+
+void bench_thread(void){
+	bench_thread_t *b = &bench_thread_data;
+	uint32_t cpu = tru_cpu_id();
+
+	tru_pmu_ccnt_enable();
+	printf("Thread kernel benchmark\n");
+
+	// Yield
+	tru_thread_create(&bench_thread_t0, cpu, 2U, bench_thread_yield_fn, b, bench_thread_stack[0], BENCH_THREAD_STACK);
+	tru_thread_create(&bench_thread_t1, cpu, 2U, bench_thread_yield_fn, b, bench_thread_stack[1], BENCH_THREAD_STACK);
+	tru_thread_run();
+	bench_thread_print("yield", b->cycles, 2U * BENCH_THREAD_YIELDS);
+
+	// Ping-pong
+	tru_thread_sem_init(&b->ping, 0U);
+	tru_thread_sem_init(&b->pong, 0U);
+	tru_thread_create(&bench_thread_t0, cpu, 2U, bench_thread_ping_fn, b, bench_thread_stack[0], BENCH_THREAD_STACK);
+	tru_thread_create(&bench_thread_t1, cpu, 3U, bench_thread_pong_fn, b, bench_thread_stack[1], BENCH_THREAD_STACK);
+	tru_thread_run();
+	bench_thread_print("ping-pong", b->cycles, 2U * BENCH_THREAD_ROUNDS);
+
+	// IRQ to thread
+	bench_thread_lat_reset(b);
+	tru_ipi_set_handler(BENCH_THREAD_SGI, bench_thread_isr);
+	tru_ipi_enable(BENCH_THREAD_SGI);
+	tru_thread_create(&bench_thread_t0, cpu, 2U, bench_thread_source_fn, b, bench_thread_stack[0], BENCH_THREAD_STACK);
+	tru_thread_create(&bench_thread_t1, cpu, 3U, bench_thread_rx_fn, b, bench_thread_stack[1], BENCH_THREAD_STACK);
+	tru_thread_run();
+	tru_ipi_disable(BENCH_THREAD_SGI);
+	tru_ipi_set_handler(BENCH_THREAD_SGI, NULL);
+	bench_thread_lat_print("irq to thread", b);
+
+	// SGI reschedule
+	bench_thread_lat_reset(b);
+	tru_thread_create(&bench_thread_t0, cpu, 2U, bench_thread_sgi_source_fn, b, bench_thread_stack[0], BENCH_THREAD_STACK);
+	tru_thread_create(&bench_thread_t1, cpu, 3U, bench_thread_rx_fn, b, bench_thread_stack[1], BENCH_THREAD_STACK);
+	tru_thread_run();
+	bench_thread_lat_print("sgi reschedule", b);
+}
+
+#else
+
+void bench_thread(void){
+	printf("Thread kernel benchmark: set TRU_CFG_THREAD to 1U\n");
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Hierarchical timer wheel (tru_timer.h).
+
+	Starts 10000 timers on CPU0: three quarters periodic with periods from
+	1 ms to 1 s (a few at 100 us), the rest one-shots that restart themselves
+	from the callback with a pseudo-random delay.  Runs them for a second and
+	prints the cost of starting and cancelling a timer, the lateness of the
+	callbacks (the global timer count at the callback against the time the
+	timer was due, it includes the wheel tick rounding) and the comparator
+	IRQ handler overhead.  Then runs 100 periodic timers with their
+	callbacks deferred to tru_defer, for the extra latency of the queue.
+
+	tru_timer takes over the global timer comparator, do not run with tru_co
+	or tru_thread on CPU0.
+*/
+
+#include "bench.h"
+#include "tru_timer.h"
+#include "tru_defer.h"
+#include <stdio.h>
+
+#define BENCH_TIMER_COUNT    10000U
+#define BENCH_TIMER_DEFERRED 100U
+#define BENCH_TIMER_RUN      tru_time_ms_to_ticks(1000U)
+#define BENCH_TIMER_DEFER_RUN tru_time_ms_to_ticks(200U)
+
+typedef struct{
+	uint32_t fires;
+	uint64_t late_sum;
+	uint64_t late_max;
+	uint32_t seed;
+}bench_timer_stat_t;
+
+static tru_timer_t bench_timer_timers[BENCH_TIMER_COUNT];
+static bench_timer_stat_t bench_timer_stat;
+
+static inline uint32_t bench_timer_rand(void){
+	bench_timer_stat.seed = bench_timer_stat.seed * 1664525U + 1013904223U;
+	return bench_timer_stat.seed >> 8U;
+}
+
+static void bench_timer_fn(tru_timer_t *timer, void *ctx){
+	bench_timer_stat_t *s = ctx;
+	uint64_t late = bench_now() - timer->fired;
+
+	s->fires++;
+	s->late_sum += late;
+	if(late > s->late_max) s->late_max = late;
+
+	// One-shot, restart 1 to 100 ms from now
+	if(timer->period == 0U){
+		tru_timer_start(timer, tru_time_ms_to_ticks(1U) + bench_timer_rand() % tru_time_ms_to_ticks(99U), 0U);
+	}
+}
+
+static void bench_timer_print(const char *name, const bench_timer_stat_t *s){
+	printf("%s: %lu callbacks, late avg %lu ns, worst %lu ns\n", name,
+		(unsigned long)s->fires,
+		(unsigned long)(s->fires ? bench_ticks_to_ns(s->late_sum / s->fires) : 0U),
+		(unsigned long)bench_ticks_to_ns(s->late_max));
+}
+
+static void bench_timer_print_isr(void){
+	tru_timer_stats_t st;
+
+	tru_timer_get_stats(0U, &st);
+	printf("isr: %lu irqs, %lu expired, %lu cascaded, %lu dropped, avg %lu ns, worst %lu ns\n",
+		(unsigned long)st.irqs, (unsigned long)st.expired, (unsigned long)st.cascaded, (unsigned long)st.dropped,
+		(unsigned long)(st.irqs ? bench_ticks_to_ns(st.isr_sum / st.irqs) : 0U),
+		(unsigned long)bench_ticks_to_ns(st.isr_max));
+}
+
+static void bench_timer_wait(uint64_t ticks){
+	uint64_t end = bench_now() + ticks;
+
+	while(bench_now() < end) __WFI();
+}
+
+void bench_timer(void){
+	bench_timer_stat_t *s = &bench_timer_stat;
+	uint32_t t0, start_cycles, cancel_cycles;
+
+	bench_timer_init();
+	tru_pmu_ccnt_enable();
+	tru_timer_cpu_init();
+	printf("Timer wheel benchmark\n");
+
+	// Many timers
+	*s = (bench_timer_stat_t){ .seed = 1U };
+	for(uint32_t i = 0U; i < BENCH_TIMER_COUNT; i++){
+		tru_timer_init(&bench_timer_timers[i], bench_timer_fn, s, 0U);
+	}
+	start_cycles = 0U;
+	for(uint32_t i = 0U; i < BENCH_TIMER_COUNT; i++){
+		uint64_t period;
+
+		if(i % 4U == 3U){
+			period = 0U;
+		}else if(i < 10U){
+			period = tru_time_us_to_ticks(100U);
+		}else{
+			period = tru_time_ms_to_ticks(1U + i % 1000U);
+		}
+		t0 = tru_pmu_ccnt();
+		tru_timer_start(&bench_timer_timers[i], period ? period : tru_time_ms_to_ticks(1U + i % 100U), period);
+		start_cycles += tru_pmu_ccnt() - t0;
+	}
+	tru_timer_reset_stats();
+	bench_timer_wait(BENCH_TIMER_RUN);
+
+	cancel_cycles = 0U;
+	for(uint32_t i = 0U; i < BENCH_TIMER_COUNT; i++){
+		t0 = tru_pmu_ccnt();
+		tru_timer_cancel(&bench_timer_timers[i]);
+		cancel_cycles += tru_pmu_ccnt() - t0;
+	}
+	printf("%u timers: start %lu cycles, cancel %lu cycles\n", BENCH_TIMER_COUNT,
+		(unsigned long)(start_cycles / BENCH_TIMER_COUNT), (unsigned long)(cancel_cycles / BENCH_TIMER_COUNT));
+	bench_timer_print("irq callbacks", s);
+	bench_timer_print_isr();
+
+	// Deferred callbacks
+	if(tru_defer_init(TRU_DEFER_MODE_SGI) == 0){
+		*s = (bench_timer_stat_t){ .seed = 1U };
+		for(uint32_t i = 0U; i < BENCH_TIMER_DEFERRED; i++){
+			tru_timer_init(&bench_timer_timers[i], bench_timer_fn, s, TRU_TIMER_DEFER);
+			tru_timer_start(&bench_timer_timers[i], tru_time_ms_to_ticks(1U), tru_time_us_to_ticks(500U) * (1U + i % 10U));
+		}
+		tru_timer_reset_stats();
+		bench_timer_wait(BENCH_TIMER_DEFER_RUN);
+		for(uint32_t i = 0U; i < BENCH_TIMER_DEFERRED; i++){
+			tru_timer_cancel(&bench_timer_timers[i]);
+		}
+		bench_timer_wait(tru_time_ms_to_ticks(1U));  // Let the callbacks already posted run
+		bench_timer_print("deferred callbacks", s);
+		bench_timer_print_isr();
+		tru_defer_exit();
+	}else{
+		printf("deferred callbacks: tru_defer already initialised, skipped\n");
+	}
+
+	tru_timer_cpu_exit();
+}
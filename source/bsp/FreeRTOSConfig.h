@@ -0,0 +1,108 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FreeRTOS kernel configuration for the Cyclone V SoC HPS (make rtos=freertos).
+
+	The kernel runs on CPU0 with the GCC ARM_CA9 port, the glue is in
+	c5soc/tru_c5soc_freertos.c.  The GIC implements 5 priority bits, so
+	there are 32 unique interrupt priorities (binary point 2), a FreeRTOS
+	interrupt priority is the group priority of irq_set_group_priority().
+	IRQs with a group priority of configMAX_API_CALL_INTERRUPT_PRIORITY or
+	higher value (lower priority) may call the FromISR API, the others are
+	never masked by the kernel.
+*/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+// Scheduler
+#define configUSE_PREEMPTION                       1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+#define configUSE_TICKLESS_IDLE                    2  // Port supplied tickless idle, driven by the global timer comparator
+#define configTICK_RATE_HZ                         1000
+#define configMAX_PRIORITIES                       8
+#define configMINIMAL_STACK_SIZE                   512  // Words
+#define configMAX_TASK_NAME_LEN                    16
+#define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_32_BITS
+#define configIDLE_SHOULD_YIELD                    1
+#define configUSE_TASK_NOTIFICATIONS               1
+#define configUSE_MUTEXES                          1
+#define configUSE_RECURSIVE_MUTEXES                1
+#define configUSE_COUNTING_SEMAPHORES              1
+#define configQUEUE_REGISTRY_SIZE                  0
+#define configUSE_TIME_SLICING                     1
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP      2
+
+// Memory (heap_4)
+#define configSUPPORT_STATIC_ALLOCATION            0
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+#define configTOTAL_HEAP_SIZE                      (1024U * 1024U)
+
+// Hooks
+#define configUSE_IDLE_HOOK                        0
+#define configUSE_TICK_HOOK                        0
+#define configUSE_MALLOC_FAILED_HOOK               0
+#define configCHECK_FOR_STACK_OVERFLOW             0
+
+// Software timers
+#define configUSE_TIMERS                           1
+#define configTIMER_TASK_PRIORITY                  (configMAX_PRIORITIES - 1)
+#define configTIMER_QUEUE_LENGTH                   8
+#define configTIMER_TASK_STACK_DEPTH               configMINIMAL_STACK_SIZE
+
+// Cortex-A9 port
+#define configUSE_TASK_FPU_SUPPORT                 2  // Every task has a VFP context, the compiler may use VFP/NEON anywhere
+#define configINTERRUPT_CONTROLLER_BASE_ADDRESS    0xFFFED000UL                  // GIC distributor (GIC_DISTRIBUTOR_BASE)
+#define configINTERRUPT_CONTROLLER_CPU_INTERFACE_OFFSET (0xFFFEC100UL - 0xFFFED000UL)  // GIC CPU interface (GIC_INTERFACE_BASE), below the distributor
+#define configUNIQUE_INTERRUPT_PRIORITIES          32
+#define configMAX_API_CALL_INTERRUPT_PRIORITY      18
+#define configSETUP_TICK_INTERRUPT()               vConfigureTickInterrupt()
+#define configCLEAR_TICK_INTERRUPT()               vClearTickInterrupt()
+
+// API functions
+#define INCLUDE_vTaskPrioritySet                   1
+#define INCLUDE_uxTaskPriorityGet                  1
+#define INCLUDE_vTaskDelete                        1
+#define INCLUDE_vTaskSuspend                       1
+#define INCLUDE_vTaskDelayUntil                    1
+#define INCLUDE_vTaskDelay                         1
+#define INCLUDE_xTaskGetSchedulerState             1
+#define INCLUDE_xTaskGetCurrentTaskHandle          1
+#define INCLUDE_xTimerPendFunctionCall             1
+
+// The port assembly includes this file too
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+void vConfigureTickInterrupt(void);
+void vClearTickInterrupt(void);
+void vPortSuppressTicksAndSleep(uint32_t xExpectedIdleTime);
+void tru_freertos_assert(const char *file, int line);
+
+#define portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime) vPortSuppressTicksAndSleep(xExpectedIdleTime)
+#define configASSERT(x) if((x) == 0) tru_freertos_assert(__FILE__, __LINE__)
+#endif
+
+#endif
@@ -48,5 +48,13 @@
 #define TRU_CFG_LOG_RN                  1U
 #define TRU_CFG_LOG_LOC                 0U
 #define TRU_CFG_DMA_BUFFER_NONCACHEABLE 1U
+#define TRU_CFG_OCRAM                   0U  // Place tagged hot code and data in the On-Chip RAM (see c5soc/tru_c5soc_hps_ocram.h)
+#define TRU_CFG_BOOT_TS                 0U  // Record boot stage timestamps (see tru_boot_ts.h)
+#define TRU_CFG_TLB_LOCK                0U  // Preload and lock the TLB entries of the IRQ path (see arm/tru_cortex_a9_tlb.h)
+#define TRU_CFG_FAST_CRT                0U  // Use the NEON .bss clear C runtime start instead of newlib's _start (see tru_crt.h)
+#define TRU_CFG_IRQ_STATS               0U  // Count the calls and cycles of each IRQ handler, always on in DEBUG builds (see arm/tru_irq_affinity.h)
+#define TRU_CFG_LAZY_VFP                0U  // Save the VFP registers in IRQ_Handler only when the handler uses them (see arm/tru_vfp_lazy.h)
+#define TRU_CFG_NESTED_IRQ              0U  // IRQ_Handler unmasks the IRQ so higher priority interrupts preempt the running handler (see irq_c5soc.c)
+#define TRU_CFG_THREAD                  0U  // Preemptive thread kernel, supplies IRQ_Handler, SVC_Handler and Undef_Handler (see tru_thread.h)
 
 #endif
@@ -0,0 +1,74 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Target : ARM Cortex-A9 CPU1 on the DE10-Nano Kit development board
+	Type   : Stand-alone C application, CPU1 image of an AMP pair (make amp=1)
+
+	Started by the CPU0 image with tru_hps_amp_start_core1().  It has no
+	stdio, it only talks to CPU0 through the shared memory rings (see
+	c5soc/tru_c5soc_hps_amp.h).  It reports in with a hello message, then
+	sums the arrays sent by CPU0 and sends back the results.
+*/
+
+#include "tru_config.h"
+#include "c5soc/tru_c5soc_hps_amp.h"
+#include "amp_demo.h"
+#include <string.h>
+
+static void doorbell_isr(void){
+	// Nothing to do, it only wakes up the main loop
+}
+
+int main(void){
+	tru_hps_amp_msg_t msg;
+
+	while(!tru_hps_amp_is_ready());
+
+	tru_hps_amp_set_doorbell(doorbell_isr);
+	tru_hps_amp_send(AMP_MSG_HELLO, NULL, 0U);
+
+	while(1){
+		while(tru_hps_amp_recv(&msg) == 0){
+			if(msg.type == AMP_MSG_SUM){
+				uint32_t values[TRU_HPS_AMP_DATA_SIZE / sizeof(uint32_t)];
+				uint32_t sum = 0U;
+
+				memcpy(values, msg.data, msg.len);
+				for(uint32_t i = 0U; i < msg.len / sizeof(uint32_t); i++){
+					sum += values[i];
+				}
+				while(tru_hps_amp_send(AMP_MSG_RESULT, &sum, sizeof(sum)));  // Retry while the ring is full
+			}
+		}
+
+		// Sleep until the next doorbell.  Interrupts are masked so a doorbell
+		// between the check and WFI is not lost, WFI still wakes up on it
+		__disable_irq();
+		if(tru_hps_amp_rx_empty()) __WFI();
+		__enable_irq();
+	}
+
+	return 0;
+}
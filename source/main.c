@@ -41,14 +41,33 @@
 
 #include "tru_config.h"
 #include "tru_logger.h"
+#include "tru_boot_ts.h"
+#include "bench/bench.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include "c5soc/tru_c5soc_hps_amp.h"
+#include "core1/amp_demo.h"
 #include <stdio.h>
+#include <string.h>
 
 // Set 1 to enable, 0 to disable
 #define DISP_LINKER_SECTIONS 0U
-
-#ifdef SEMIHOSTING
-	extern void initialise_monitor_handles(void);  // Reference function header from the external Semihosting library
-#endif
+#define RUN_BENCH_ACP        0U
+#define RUN_BENCH_OCRAM      0U
+#define DISP_BOOT_TS         0U  // Needs TRU_CFG_BOOT_TS
+#define RUN_BENCH_CRT        0U
+#define RUN_CORE1            0U
+#define RUN_BENCH_LOCK       0U
+#define RUN_BENCH_QUEUE      0U
+#define RUN_BENCH_TASK       0U
+#define RUN_BENCH_IPI        0U
+#define RUN_BENCH_IRQ_NEST   0U
+#define RUN_BENCH_FIQ        0U
+#define RUN_BENCH_DEFER      0U
+#define RUN_BENCH_IRQ_LAT    0U
+#define RUN_BENCH_CO         0U
+#define RUN_BENCH_TIMER      0U
+#define RUN_BENCH_FREERTOS   0U  // Needs make rtos=freertos, does not return
+#define RUN_BENCH_THREAD     0U  // Needs TRU_CFG_THREAD
 
 #if (DISP_LINKER_SECTIONS == 1U)
 	extern long unsigned int __mmu_ttb_l1_entries_start;  // Reference external symbol name from the linker file
@@ -75,6 +94,68 @@
 	}
 #endif
 
+#if (RUN_CORE1 == 1U)
+	static volatile uint32_t core1_counter;
+
+	// Entry point of CPU1, replaces the default weak one (see c5soc/tru_c5soc_hps_smp.h)
+	void main_core1(void){
+		while(1){
+			core1_counter++;
+		}
+	}
+
+	void start_core1(void){
+		if(tru_hps_smp_start_core1() == 0){
+			uint32_t count = core1_counter;
+			for(volatile uint32_t i = 0U; i < 100000U; i++);
+			printf("CPU1 started, counter: %lu -> %lu\n", (unsigned long)count, (unsigned long)core1_counter);
+		}else{
+			printf("CPU1 failed to start\n");
+		}
+	}
+#endif
+
+#if defined(TRU_AMP) && TRU_AMP == 1U
+	// ========================================
+	// AMP demonstration (only with make amp=1)
+	// ========================================
+
+	// CPU1 runs its own image built from the core1 folder, which sums the arrays sent to it
+
+	static void amp_doorbell_isr(void){
+		// Nothing to do, the messages are polled below
+	}
+
+	// Waits for a message from CPU1, returns 0 on success or -1 on timeout
+	static int amp_wait_msg(tru_hps_amp_msg_t *msg){
+		for(uint32_t i = 0U; i < 10000000U; i++){
+			if(tru_hps_amp_recv(msg) == 0) return 0;
+		}
+		return -1;
+	}
+
+	void run_amp(void){
+		tru_hps_amp_msg_t msg;
+		uint32_t values[4] = { 1U, 2U, 3U, 4U };
+		uint32_t sum;
+
+		tru_hps_amp_init();
+		tru_hps_amp_set_doorbell(amp_doorbell_isr);
+
+		if(tru_hps_amp_start_core1() || amp_wait_msg(&msg) || msg.type != AMP_MSG_HELLO){
+			printf("AMP: CPU1 image failed to start\n");
+			return;
+		}
+		printf("AMP: CPU1 image started\n");
+
+		tru_hps_amp_send(AMP_MSG_SUM, values, sizeof(values));
+		if(amp_wait_msg(&msg) == 0 && msg.type == AMP_MSG_RESULT){
+			memcpy(&sum, msg.data, sizeof(sum));
+			printf("AMP: sum from CPU1: %lu\n", (unsigned long)sum);
+		}
+	}
+#endif
+
 // ====================================
 // U-Boot input arguments demonstration
 // ====================================
@@ -97,20 +178,95 @@ void tx_cli_args(int argc, char *const argv[]){
 }
 
 int main(int argc, char *const argv[]){
-	#ifdef SEMIHOSTING
-		initialise_monitor_handles();  // Initialise Semihosting
-	#endif
+	tru_boot_ts_mark(TRU_BOOT_TS_MAIN);
+	tru_bsp_init();  // Board initialisation, e.g. Semihosting
 
 	printf("Hello, World!\n");
 
+	#if (DISP_BOOT_TS == 1U)
+		tru_boot_ts_print();
+	#endif
+
 	#if (DISP_LINKER_SECTIONS == 1U)
 		disp_linker_sections();
 	#endif
 
+	#if (RUN_BENCH_ACP == 1U)
+		bench_acp();
+	#endif
+
+	#if (RUN_BENCH_OCRAM == 1U)
+		bench_ocram();
+	#endif
+
+	#if (RUN_BENCH_CRT == 1U)
+		bench_crt();
+	#endif
+
+	#if (RUN_CORE1 == 1U)
+		start_core1();
+	#endif
+
+	#if (RUN_BENCH_LOCK == 1U)
+		bench_lock();
+	#endif
+
+	#if (RUN_BENCH_QUEUE == 1U)
+		bench_queue();
+	#endif
+
+	#if (RUN_BENCH_TASK == 1U)
+		bench_task();
+	#endif
+
+	#if (RUN_BENCH_IPI == 1U)
+		bench_ipi();
+	#endif
+
+	#if (RUN_BENCH_IRQ_NEST == 1U)
+		bench_irq_nest();
+	#endif
+
+	#if (RUN_BENCH_FIQ == 1U)
+		bench_fiq();
+	#endif
+
+	#if (RUN_BENCH_DEFER == 1U)
+		bench_defer();
+	#endif
+
+	#if (RUN_BENCH_IRQ_LAT == 1U)
+		bench_irq_lat();
+	#endif
+
+	#if (RUN_BENCH_CO == 1U)
+		bench_co();
+	#endif
+
+	#if (RUN_BENCH_TIMER == 1U)
+		bench_timer();
+	#endif
+
+	#if (RUN_BENCH_THREAD == 1U)
+		bench_thread();
+	#endif
+
+	#if (RUN_BENCH_FREERTOS == 1U)
+		bench_freertos();
+	#endif
+
+	#if defined(TRU_AMP) && TRU_AMP == 1U
+		run_amp();
+	#endif
+
 	#if(TRU_EXIT_TO_UBOOT == 1U)
 		//tx_cli_args(argc, argv);
 		tx_cli_args(uboot_argc, uboot_argv);
 
+		#if (RUN_CORE1 == 1U) || (defined(TRU_AMP) && TRU_AMP == 1U)
+			tru_hps_smp_stop_core1();  // Put CPU1 back into reset before returning to U-Boot
+		#endif
+
 		printf("Exiting application..\n");
 		tru_hps_uart_ll_wait_empty((void *)TRU_HPS_UART0_BASE);  // Before returning to U-Boot, we will wait for the UART to empty out
 	#endif
@@ -0,0 +1,149 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 atomic operations on 32-bit words using LDREX/STREX.
+
+	The operations that return a value are fully ordered, i.e. there is a DMB
+	before and after, so they can be used to publish data to the other CPU
+	without extra barriers.  tru_atomic_load() and tru_atomic_store() are
+	single accesses with a barrier on the side that matters.
+
+	Between the two CPUs the exclusive accesses are only reliable on memory
+	that is coherent through the SCU, i.e. cacheable memory with the D-cache
+	and ACTLR.SMP enabled (TRU_L1_CACHE and TRU_SMP_COHERENCY, the release
+	defaults).  With the D-cache off (the debug defaults) they rely on the
+	exclusive monitor of the interconnect.  On a single CPU they are always
+	safe against the IRQ handlers, because IRQ_Handler clears the local
+	monitor with CLREX before returning.
+
+	References:
+		- Arm Architecture Reference Manual Armv7-A and Armv7-R edition
+		  Notable sections:
+		- Synchronization and semaphores
+		- Exclusive access instructions and Shareable memory regions
+*/
+
+#ifndef TRU_ATOMIC_H
+#define TRU_ATOMIC_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+static inline uint32_t tru_atomic_load(const volatile uint32_t *p){
+	uint32_t val = *p;
+
+	__dmb();  // Later accesses are not done before the load
+	return val;
+}
+
+static inline void tru_atomic_store(volatile uint32_t *p, uint32_t val){
+	__dmb();  // Earlier accesses are done before the store
+	*p = val;
+}
+
+// Adds val and returns the new value
+static inline uint32_t tru_atomic_add(volatile uint32_t *p, uint32_t val){
+	uint32_t result;
+	uint32_t fail;
+
+	__dmb();
+	__asm__ volatile(
+		"1:	ldrex	%0, [%2]\n"
+		"	add	%0, %0, %3\n"
+		"	strex	%1, %0, [%2]\n"
+		"	teq	%1, #0\n"
+		"	bne	1b"
+		: "=&r" (result), "=&r" (fail)
+		: "r" (p), "Ir" (val)
+		: "cc", "memory"
+	);
+	__dmb();
+
+	return result;
+}
+
+// Subtracts val and returns the new value
+static inline uint32_t tru_atomic_sub(volatile uint32_t *p, uint32_t val){
+	return tru_atomic_add(p, 0U - val);
+}
+
+// Writes val and returns the old value
+static inline uint32_t tru_atomic_xchg(volatile uint32_t *p, uint32_t val){
+	uint32_t old;
+	uint32_t fail;
+
+	__dmb();
+	__asm__ volatile(
+		"1:	ldrex	%0, [%2]\n"
+		"	strex	%1, %3, [%2]\n"
+		"	teq	%1, #0\n"
+		"	bne	1b"
+		: "=&r" (old), "=&r" (fail)
+		: "r" (p), "r" (val)
+		: "cc", "memory"
+	);
+	__dmb();
+
+	return old;
+}
+
+// Compare and swap: writes desired if the value equals expected.  Returns the old value, so the swap was done if it equals expected
+static inline uint32_t tru_atomic_cmpxchg(volatile uint32_t *p, uint32_t expected, uint32_t desired){
+	uint32_t old;
+	uint32_t fail;
+
+	__dmb();
+	__asm__ volatile(
+		"1:	ldrex	%0, [%2]\n"
+		"	teq	%0, %3\n"
+		"	bne	2f\n"
+		"	strex	%1, %4, [%2]\n"
+		"	teq	%1, #0\n"
+		"	bne	1b\n"
+		"	b	3f\n"
+		"2:	clrex\n"
+		"3:"
+		: "=&r" (old), "=&r" (fail)
+		: "r" (p), "r" (expected), "r" (desired)
+		: "cc", "memory"
+	);
+	__dmb();
+
+	return old;
+}
+
+// Compare and swap, returns true if the swap was done
+static inline bool tru_atomic_cas(volatile uint32_t *p, uint32_t expected, uint32_t desired){
+	return tru_atomic_cmpxchg(p, expected, desired) == expected;
+}
+
+#endif
+
+#endif
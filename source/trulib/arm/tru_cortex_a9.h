@@ -34,7 +34,9 @@
 #if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
 
 #include <stdint.h>
+#include <stdbool.h>
 
+#define TRU_SCU_BASE           (TRU_PERIPH_BASE + 0x0U)
 #define TRU_GLOBAL_TIMER_BASE  (TRU_PERIPH_BASE + 0x200U)
 #define TRU_PRIVATE_TIMER_BASE (TRU_PERIPH_BASE + 0x600U)
 
@@ -64,6 +66,76 @@
 // MMU related
 #define __write_tlbimvaa(va)  __asm__ volatile("MRC p15, 0, %0, c8, c7, 3" : : "r"(va) : "memory")
 
+// Performance monitor related
+#define __read_pmcr(result)     __asm__ volatile("MRC p15, 0, %0, c9, c12, 0" : "=r"(result) : : "memory")
+#define __write_pmcr(val)       __asm__ volatile("MCR p15, 0, %0, c9, c12, 0" : : "r"(val) : "memory")
+#define __write_pmcntenset(val) __asm__ volatile("MCR p15, 0, %0, c9, c12, 1" : : "r"(val) : "memory")
+#define __read_pmccntr(result)  __asm__ volatile("MRC p15, 0, %0, c9, c13, 0" : "=r"(result) : : "memory")
+
+// ==========
+// MPCore CPU
+// ==========
+
+// Returns the ID of the calling CPU, 0 or 1
+static inline uint32_t tru_cpu_id(void){
+	uint32_t mpidr;
+
+	__read_mpidr(mpidr);
+	return mpidr & 0x3U;
+}
+
+// =================================
+// Performance monitor cycle counter
+// =================================
+
+#define PMCR_E_MSK          0x1U         // Enable all counters
+#define PMCR_C_MSK          0x4U         // Reset the cycle counter
+#define PMCR_D_MSK          0x8U         // Cycle counter counts every 64th cycle
+#define PMCNTENSET_CCNT_MSK 0x80000000U  // Cycle counter enable
+
+// Starts the cycle counter of the calling CPU, counting every processor clock cycle
+static inline void tru_pmu_ccnt_enable(void){
+	uint32_t pmcr;
+
+	__read_pmcr(pmcr);
+	__write_pmcr((pmcr | PMCR_E_MSK | PMCR_C_MSK) & ~PMCR_D_MSK);
+	__write_pmcntenset(PMCNTENSET_CCNT_MSK);
+}
+
+// Returns the cycle counter of the calling CPU, it wraps around after 2^32 cycles
+static inline uint32_t tru_pmu_ccnt(void){
+	uint32_t ccnt;
+
+	__read_pmccntr(ccnt);
+	return ccnt;
+}
+
+// ==================
+// Snoop Control Unit
+// ==================
+
+typedef struct{
+	volatile uint32_t control;
+	volatile uint32_t config;
+	volatile uint32_t powerstatus;
+	volatile uint32_t invalidateall;
+	volatile uint32_t res1[12];
+	volatile uint32_t filterstart;
+	volatile uint32_t filterend;
+	volatile uint32_t res2[2];
+	volatile uint32_t sac;
+	volatile uint32_t snsac;
+}scu_reg_t;
+
+#define SCU_REG ((volatile scu_reg_t *const)TRU_SCU_BASE)
+
+#define SCU_CONTROL_ENABLE_POS 0U
+#define SCU_CONTROL_ENABLE_MSK 0x1U
+
+static inline bool scu_is_enabled(void){
+	return SCU_REG->control & SCU_CONTROL_ENABLE_MSK;
+}
+
 // ============
 // Global timer
 // ============
@@ -169,6 +241,20 @@ static inline void gtim_clear_event(void){
 	GTIM_REG->intrstatus.bits.eventflag = 1;
 }
 
+// Arms the comparator (banked per CPU) to raise the global timer IRQ at the given count.  The compare is disabled while
+// the two halves are written, so it cannot match a mix of the old and new value
+static inline void gtim_arm_compare(uint64_t compare){
+	GTIM_REG->control.val &= ~GTIM_CONTROL_COMPARE_ENABLE_MSK;
+	GTIM_REG->comparel = (uint32_t)compare;
+	GTIM_REG->compareh = (uint32_t)(compare >> 32U);
+	GTIM_REG->control.val |= GTIM_CONTROL_COMPARE_ENABLE_MSK | GTIM_CONTROL_IRQ_ENABLE_MSK;
+}
+
+// Disables the compare and its IRQ of the calling CPU
+static inline void gtim_disarm_compare(void){
+	GTIM_REG->control.val &= ~(GTIM_CONTROL_COMPARE_ENABLE_MSK | GTIM_CONTROL_IRQ_ENABLE_MSK);
+}
+
 // ========================
 // Private timer & watchdog
 // ========================
@@ -0,0 +1,184 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_cortex_a9_tlb.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_cortex_a9.h"
+#include "tru_logger.h"
+
+#define TRU_TLB_COLLECT_MAX 16U
+
+extern const tru_tlb_region_t __tlb_lock_regions_start[];  // Reference external symbol name from the linker file
+extern const tru_tlb_region_t __tlb_lock_regions_end[];    // Reference external symbol name from the linker file
+
+#if defined(TRU_TLB_LOCK) && TRU_TLB_LOCK == 1U
+	extern void Vectors(void);                  // Reference external symbol name from the startup file
+	extern uint32_t __IRQ_STACK_BASE;           // Reference external symbol name from the linker file
+	extern uint32_t __IRQ_STACK_LIMIT;          // Reference external symbol name from the linker file
+	extern uint32_t __tlb_lock_text_start;      // Reference external symbol name from the linker file
+	extern uint32_t __tlb_lock_text_end;        // Reference external symbol name from the linker file
+	extern uint32_t __tlb_lock_data_start;      // Reference external symbol name from the linker file
+	extern uint32_t __tlb_lock_data_end;        // Reference external symbol name from the linker file
+
+	// Default regions of the IRQ entry path
+	TRU_TLB_LOCK_REGION(vectors, "Vectors", Vectors, (const uint8_t *)Vectors + 32U);
+	TRU_TLB_LOCK_REGION(irq_stack, "IRQ stack", &__IRQ_STACK_BASE, &__IRQ_STACK_LIMIT);
+	TRU_TLB_LOCK_REGION(lock_text, "TLB lock text", &__tlb_lock_text_start, &__tlb_lock_text_end);
+	TRU_TLB_LOCK_REGION(lock_data, "TLB lock data", &__tlb_lock_data_start, &__tlb_lock_data_end);
+	TRU_TLB_LOCK_REGION(gic, "SCU and GIC", TRU_SCU_BASE, TRU_SCU_BASE + 0x2000U);  // Touches the SCU control and with 4K pages the GIC distributor control register, neither is read sensitive
+#endif
+
+/*
+	Returns the size covered by the translation of a virtual address, i.e. a
+	1MB section, 64K large page or 4K small page.  A TLB entry covers the same.
+*/
+static uint32_t tru_tlb_granule(uint32_t va){
+	const uint32_t *l1 = (const uint32_t *)(__get_TTBR0() & 0xffffc000U);
+	uint32_t desc = l1[va >> 20U];
+
+	if((desc & 0x3U) == 0x1U){  // Page table descriptor?
+		const uint32_t *l2 = (const uint32_t *)(desc & 0xfffffc00U);
+		uint32_t desc2 = l2[(va >> 12U) & 0xffU];
+
+		return (desc2 & 0x2U) ? 0x1000U : 0x10000U;  // Small or large page
+	}
+
+	return TRU_TLB_LOCK_SECTION_SZ;
+}
+
+/*
+	Collects the sections (or pages) of all the regions without duplicates, and
+	for each an address to touch.  Returns the number stored.
+	Note, this is called from SystemInit() so it must not use global variables.
+*/
+static uint32_t tru_tlb_collect(uint32_t *sections, uint32_t *touch, uint32_t max){
+	uint32_t n = 0U;
+
+	for(const tru_tlb_region_t *r = __tlb_lock_regions_start; r < __tlb_lock_regions_end; r++){
+		uint32_t start = (uint32_t)r->start;
+		uint32_t end = (uint32_t)r->end;
+		uint32_t va = start;
+
+		if(end <= start) continue;  // Empty region
+
+		while(va < end){
+			uint32_t granule = tru_tlb_granule(va);
+			uint32_t j;
+
+			va &= ~(granule - 1U);
+			for(j = 0U; j < n; j++){
+				if(sections[j] == va) break;
+			}
+			if(j == n && n < max){
+				sections[n] = va;
+				touch[n] = (va < start) ? start : va;  // First address of the region, or the base of the following sections
+				n++;
+			}
+
+			if(va + granule < va) break;  // Wrapped around the end of the address space
+			va += granule;
+		}
+	}
+
+	return n;
+}
+
+/*
+	Preloads and locks the translations of the regions into the lockable main
+	TLB entries.  This must be called after the translation table is final and
+	the MMU is enabled.  Returns the number of locked sections.
+*/
+uint32_t tru_tlb_lock_regions(void){
+	uint32_t sections[TRU_TLB_COLLECT_MAX];
+	uint32_t touch[TRU_TLB_COLLECT_MAX];
+	uint32_t n = tru_tlb_collect(sections, touch, TRU_TLB_COLLECT_MAX);
+	uint32_t tmp;
+
+	if(n > TRU_TLB_LOCK_ENTRIES) n = TRU_TLB_LOCK_ENTRIES;
+
+	for(uint32_t i = 0U; i < n; i++){
+		// Kept as one sequence so no other table walk can happen while the preserve bit is set
+		__asm__ volatile(
+			"MCR p15, 0, %[va], c8, c7, 3      \n"  // TLBIMVAA: remove any unlocked copy of the translation
+			"DSB                               \n"
+			"ISB                               \n"
+			"MCR p15, 0, %[lock], c10, c0, 0   \n"  // Set preserve bit and victim entry
+			"ISB                               \n"
+			"LDR %[tmp], [%[touch]]            \n"  // The table walk loads the translation into the victim entry
+			"DSB                               \n"
+			"ISB                               \n"
+			"MCR p15, 0, %[unlock], c10, c0, 0 \n"  // Clear preserve bit
+			"ISB                               \n"
+			: [tmp] "=&r" (tmp)
+			: [va] "r" (sections[i]),
+			  [lock] "r" (TRU_TLB_LOCKDOWN_P_MSK | (i << TRU_TLB_LOCKDOWN_VICTIM_POS)),
+			  [touch] "r" (touch[i]),
+			  [unlock] "r" (((i + 1U) % TRU_TLB_LOCK_ENTRIES) << TRU_TLB_LOCKDOWN_VICTIM_POS)
+			: "memory"
+		);
+	}
+
+	return n;
+}
+
+// Releases the locked translations back to normal TLB entries
+void tru_tlb_unlock_regions(void){
+	uint32_t sections[TRU_TLB_COLLECT_MAX];
+	uint32_t touch[TRU_TLB_COLLECT_MAX];
+	uint32_t n = tru_tlb_collect(sections, touch, TRU_TLB_COLLECT_MAX);
+
+	if(n > TRU_TLB_LOCK_ENTRIES) n = TRU_TLB_LOCK_ENTRIES;
+
+	tru_tlb_write_lockdown(0U);
+	__ISB();
+	for(uint32_t i = 0U; i < n; i++){
+		__set_TLBIMVAA(sections[i]);  // Locked entries are only removed by invalidate by MVA
+	}
+	__DSB();
+	__ISB();
+}
+
+void tru_tlb_lock_dump(void){
+	uint32_t sections[TRU_TLB_COLLECT_MAX];
+	uint32_t touch[TRU_TLB_COLLECT_MAX];
+	uint32_t n = tru_tlb_collect(sections, touch, TRU_TLB_COLLECT_MAX);
+
+	LOG("TLB lock regions:\n");
+	for(const tru_tlb_region_t *r = __tlb_lock_regions_start; r < __tlb_lock_regions_end; r++){
+		LOG("  0x%.8lx-0x%.8lx %s\n", (unsigned long)r->start, (unsigned long)r->end, r->name);
+	}
+
+	LOG("TLB lock sections:\n");
+	for(uint32_t i = 0U; i < n; i++){
+		LOG("  0x%.8lx %s\n", (unsigned long)sections[i], (i < TRU_TLB_LOCK_ENTRIES) ? "locked" : "not locked, no free entry");
+	}
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 main TLB lockdown.
+
+	The main TLB has 4 lockable entries which are never evicted by normal
+	replacement.  Locking the translations for the vectors, IRQ handlers, IRQ
+	stack, ISR data and the GIC removes the translation table walks from the
+	worst case IRQ entry path.  A locked entry covers the section or page size
+	of the translation, e.g. 1MB with the section table in mmu_c5soc.c, so
+	regions in the same section share an entry.
+
+	Regions are collected by the linker from the .tlb_lock_regions section,
+	see TRU_TLB_LOCK_REGION().  Code and data tagged with TRU_TLB_LOCK_TEXT
+	and TRU_TLB_LOCK_DATA are grouped by the linker script into blocks that
+	are locked automatically.  When more sections are needed than there are
+	lockable entries, the extra ones are not locked, see tru_tlb_lock_dump().
+
+	References:
+		- Cortex-A9 Technical Reference Manual
+		  Notable sections:
+		- c10, TLB Lockdown Register
+		- TLB organization
+*/
+
+#ifndef TRU_CORTEX_A9_TLB_H
+#define TRU_CORTEX_A9_TLB_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+
+#define TRU_TLB_LOCK_ENTRIES     4U
+#define TRU_TLB_LOCK_SECTION_SZ  0x100000UL  // Size of a section translation (1MB)
+
+// TLB Lockdown Register bits
+#define TRU_TLB_LOCKDOWN_P_POS      0U
+#define TRU_TLB_LOCKDOWN_P_MSK      (0x1UL << TRU_TLB_LOCKDOWN_P_POS)  // 1 = Preserve, i.e. subsequent TLB allocations go into the lockable entry at Victim
+#define TRU_TLB_LOCKDOWN_VICTIM_POS 28U
+#define TRU_TLB_LOCKDOWN_VICTIM_MSK (0x7UL << TRU_TLB_LOCKDOWN_VICTIM_POS)
+
+typedef struct{
+	const void *start;  // First address of the region, this is also the address touched to load the translation
+	const void *end;    // One past the last address of the region
+	const char *name;
+}tru_tlb_region_t;
+
+#if defined(TRU_TLB_LOCK) && TRU_TLB_LOCK == 1U
+	#define TRU_TLB_LOCK_TEXT __attribute__((section(".tlb_lock_text")))
+	#define TRU_TLB_LOCK_DATA __attribute__((section(".tlb_lock_data")))
+
+	// Adds a region to the lock table collected by the linker.  Note, the start address is read, so it must not be a read sensitive register
+	#define TRU_TLB_LOCK_REGION(id, region_name, region_start, region_end) \
+		static const tru_tlb_region_t tru_tlb_region_##id __attribute__((section(".tlb_lock_regions"), used)) = { \
+			.start = (const void *)(region_start), \
+			.end = (const void *)(region_end), \
+			.name = region_name \
+		}
+#else
+	#define TRU_TLB_LOCK_TEXT
+	#define TRU_TLB_LOCK_DATA
+	#define TRU_TLB_LOCK_REGION(id, region_name, region_start, region_end)
+#endif
+
+static inline uint32_t tru_tlb_read_lockdown(void){
+	uint32_t val;
+	__asm__ volatile("MRC p15, 0, %0, c10, c0, 0" : "=r"(val) : : "memory");
+	return val;
+}
+
+static inline void tru_tlb_write_lockdown(uint32_t val){
+	__asm__ volatile("MCR p15, 0, %0, c10, c0, 0" : : "r"(val) : "memory");
+}
+
+uint32_t tru_tlb_lock_regions(void);
+void tru_tlb_unlock_regions(void);
+void tru_tlb_lock_dump(void);
+
+#endif
+
+#endif
@@ -0,0 +1,163 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FIQ fast path for a single ultra-low-latency interrupt source.
+*/
+
+#include "tru_fiq.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9_tlb.h"
+#include <stddef.h>
+
+static IRQn_Type tru_fiq_irqn = (IRQn_Type)-1;
+
+/*
+	Fast interrupt handler, overrides the weak alias in startup_c5soc.c.
+	Banked registers loaded by tru_fiq_init():
+		r8 = GIC CPU interface base
+		r9 = callback
+	r10 holds the interrupt ID across the call, r8-r11 are callee saved by the
+	AAPCS and r12 is banked, so only r0-r3 and lr are pushed.  r0 points to
+	them (tru_fiq_frame_t) for a callback that takes the frame.
+*/
+TRU_TLB_LOCK_TEXT __attribute__((naked)) void FIQ_Handler(void){
+	__ASM volatile(
+		"SUB    lr, lr, #4                    \n"  // Return address
+		"PUSH   {r0-r3, r12, lr}              \n"  // r12 is only pushed to keep the stack 8 byte aligned
+		"LDR    r10, [r8, #0x0C]              \n"  // Acknowledge (GICC_IAR)
+		"MOV    r0, sp                        \n"  // Frame argument
+		"CMP    r10, #1020                    \n"  // Spurious (1022 or 1023)?
+		"BLXLO  r9                            \n"  // No, call the callback
+		"STR    r10, [r8, #0x10]              \n"  // Set interrupt is serviced (GICC_EOIR), a spurious ID is ignored
+		"CLREX                                \n"  // Clear the local exclusive monitor, as IRQ_Handler does
+		"LDMFD  sp!, {r0-r3, r12, pc}^        \n"  // Return, restoring CPSR from SPSR_fiq
+	);
+}
+
+// Loads the banked FIQ mode r8 and r9 of the calling CPU
+static void tru_fiq_load_banked(uint32_t gicc, uint32_t handler){
+	register uint32_t r0 __ASM("r0") = gicc;
+	register uint32_t r1 __ASM("r1") = handler;
+
+	__ASM volatile(
+		"MRS    r2, cpsr                      \n"
+		"CPSID  if, #0x11                     \n"  // FIQ mode, masked
+		"MOV    r8, r0                        \n"
+		"MOV    r9, r1                        \n"
+		"MSR    cpsr_c, r2                    \n"  // Back to the previous mode and masks
+		:
+		: "r" (r0), "r" (r1)
+		: "r2", "memory"
+	);
+}
+
+// Enables Group 1 (IRQ) and the acknowledge of it on the CPU interface of the calling CPU
+void tru_fiq_cpu_init(void){
+	GICInterface->CTLR |= TRU_GICC_CTLR_ENABLE_GRP0 | TRU_GICC_CTLR_ENABLE_GRP1 | TRU_GICC_CTLR_ACKCTL;
+}
+
+/*
+	Routes one interrupt as a Group 0 FIQ to the calling CPU.  All other
+	interrupts are moved to Group 1 and stay IRQs.  For an SPI the target is
+	set to the calling CPU.  FIQ_Handler calls fiq_fn with the frame in r0,
+	the address is handed over as an integer so neither handler type is cast
+	to the other.
+*/
+static void tru_fiq_route(IRQn_Type irqn, uint32_t fiq_fn, tru_fiq_handler_t irq_handler){
+	uint32_t num_irq = 32U * ((GIC_DistributorInfo() & 0x1FU) + 1U);
+
+	if(irqn < 0 || (uint32_t)irqn >= num_irq) return;
+
+	IRQ_Disable(irqn);
+	GIC_DisableInterface();  // Disable interrupt forwarding while the groups change
+
+	// Everything else to Group 1, IGROUPR0 (SGIs and PPIs) is banked per CPU
+	for(uint32_t i = 0U; i < num_irq / 32U; i++){
+		GICDistributor->IGROUPR[i] = 0xFFFFFFFFUL;
+	}
+	GIC_SetGroup(irqn, 0U);
+	GIC_SetPriority(irqn, TRU_FIQ_PRIORITY);
+	if(irqn >= 32) GIC_SetTarget(irqn, 1UL << (__get_MPIDR() & 3U));
+
+	// Also in the IRQ table, in case IRQ_Handler acknowledges it first while the FIQ is masked
+	IRQ_SetHandler(irqn, irq_handler);
+	tru_fiq_load_banked(GIC_INTERFACE_BASE, fiq_fn);
+	tru_fiq_irqn = irqn;
+
+	GICDistributor->CTLR |= TRU_GICD_CTLR_ENABLE_GRP0 | TRU_GICD_CTLR_ENABLE_GRP1;
+	tru_fiq_cpu_init();
+	GICInterface->CTLR |= TRU_GICC_CTLR_FIQEN;
+	GIC_EnableInterface();
+	__DSB();
+	__ISB();
+}
+
+/*
+	Routes one interrupt as a Group 0 FIQ to the calling CPU and calls the
+	handler from FIQ_Handler with the frame of the interrupted code.
+	irq_handler is called instead, without a frame, if IRQ_Handler
+	acknowledges the interrupt first while the FIQ is masked.
+	The groups and priorities of SGIs and PPIs are banked, for a PPI each CPU
+	that takes it calls this.
+*/
+void tru_fiq_init_frame(IRQn_Type irqn, tru_fiq_frame_handler_t handler, tru_fiq_handler_t irq_handler){
+	tru_fiq_route(irqn, (uint32_t)handler, irq_handler);
+}
+
+/*
+	Routes one interrupt as a Group 0 FIQ to the calling CPU and calls the
+	handler from FIQ_Handler, and from IRQ_Handler if it acknowledges it first.
+	The frame FIQ_Handler passes in r0 is ignored by a handler without
+	arguments (AAPCS).
+*/
+void tru_fiq_init(IRQn_Type irqn, tru_fiq_handler_t handler){
+	tru_fiq_route(irqn, (uint32_t)handler, handler);
+}
+
+// Enables the FIQ interrupt source
+void tru_fiq_enable(void){
+	if(tru_fiq_irqn >= 0) IRQ_Enable(tru_fiq_irqn);
+}
+
+// Disables the FIQ interrupt source
+void tru_fiq_disable(void){
+	if(tru_fiq_irqn >= 0) IRQ_Disable(tru_fiq_irqn);
+}
+
+// Disables the FIQ and signals Group 0 as IRQ again, the interrupt source goes back to IRQ_Handler
+void tru_fiq_exit(void){
+	if(tru_fiq_irqn < 0) return;
+
+	IRQ_Disable(tru_fiq_irqn);
+	GICInterface->CTLR &= ~TRU_GICC_CTLR_FIQEN;
+	GIC_SetGroup(tru_fiq_irqn, 1U);
+	IRQ_SetHandler(tru_fiq_irqn, NULL);
+	tru_fiq_irqn = (IRQn_Type)-1;
+	__DSB();
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FIQ fast path for a single ultra-low-latency interrupt source.
+
+	tru_fiq_init() moves every GIC interrupt to Group 1 (IRQ) except the
+	chosen one, which stays in Group 0 with the highest priority and is
+	signalled as FIQ (GICC_CTLR.FIQEn).  Secure reads of GICC_IAR still
+	acknowledge Group 1 interrupts (GICC_CTLR.AckCtl), so IRQ_Handler keeps
+	working unchanged.
+
+	FIQ_Handler skips the IRQ dispatcher and the VFP save.  It runs on the FIQ
+	stack and keeps the GIC CPU interface base and the callback in the banked
+	r8 and r9, which tru_fiq_init() loads once, so the entry is:
+	acknowledge, call, EOI, return.  The callback runs with the IRQ and FIQ
+	masked and must not use the VFP/NEON (no floating point, no memcpy that
+	may be vectorised), it is not saved.
+
+	A handler registered with tru_fiq_init_frame() gets the registers saved
+	on entry, with the return address of the interrupted code.  SPSR_fiq
+	holds its CPSR, e.g. for a sampling profiler (tru_prof.h).
+
+	The GICC_CTLR and the r8/r9 banked registers are per CPU, tru_fiq_init()
+	configures the calling CPU only.  Another CPU that receives SPIs must call
+	tru_fiq_cpu_init() to enable Group 1 on its CPU interface.
+*/
+
+#ifndef TRU_FIQ_H
+#define TRU_FIQ_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+
+// GICD_CTLR bits (with the Security Extensions, secure access)
+#define TRU_GICD_CTLR_ENABLE_GRP0 (1UL << 0U)
+#define TRU_GICD_CTLR_ENABLE_GRP1 (1UL << 1U)
+
+// GICC_CTLR bits (with the Security Extensions, secure access)
+#define TRU_GICC_CTLR_ENABLE_GRP0 (1UL << 0U)
+#define TRU_GICC_CTLR_ENABLE_GRP1 (1UL << 1U)
+#define TRU_GICC_CTLR_ACKCTL      (1UL << 2U)  // Secure GICC_IAR read can acknowledge Group 1 interrupts
+#define TRU_GICC_CTLR_FIQEN       (1UL << 3U)  // Group 0 interrupts are signalled as FIQ
+
+#define TRU_FIQ_PRIORITY 0x00U  // Highest, so the FIQ is signalled whatever the GIC running priority is
+
+typedef void (*tru_fiq_handler_t)(void);
+
+// Registers saved by FIQ_Handler, the rest are untouched or banked
+typedef struct{
+	uint32_t r0;
+	uint32_t r1;
+	uint32_t r2;
+	uint32_t r3;
+	uint32_t r12;
+	uint32_t pc;  // Return address, the next instruction of the interrupted code
+}tru_fiq_frame_t;
+
+typedef void (*tru_fiq_frame_handler_t)(const tru_fiq_frame_t *frame);
+
+void tru_fiq_cpu_init(void);
+void tru_fiq_init(IRQn_Type irqn, tru_fiq_handler_t handler);
+void tru_fiq_init_frame(IRQn_Type irqn, tru_fiq_frame_handler_t handler, tru_fiq_handler_t irq_handler);
+void tru_fiq_enable(void);
+void tru_fiq_disable(void);
+void tru_fiq_exit(void);
+
+#endif
+
+#endif
@@ -0,0 +1,107 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Inter-processor interrupts (IPI) between the two Cortex-A9 CPUs.
+*/
+
+#include "tru_ipi.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cache.h"
+#include "tru_cortex_a9.h"
+#include <stddef.h>
+
+// Mailbox slot, one per receiver and sender pair
+typedef struct{
+	volatile uint32_t full;
+	volatile uint32_t word;
+}__attribute__((aligned(CACHELINE_SIZE))) tru_ipi_mbox_t;
+
+static tru_ipi_mbox_t tru_ipi_mbox[TRU_IPI_CPUS][TRU_IPI_CPUS];  // [receiver][sender]
+static tru_ipi_mbox_handler_t tru_ipi_mbox_handler[TRU_IPI_CPUS];
+
+// Sets the handler of an SGI for both CPUs
+void tru_ipi_set_handler(IRQn_Type sgi, IRQHandler_t handler){
+	IRQ_SetHandler(sgi, handler);
+	__DSB();  // The other CPU sees the handler before it is interrupted
+}
+
+// Enables receiving the SGI on the calling CPU
+void tru_ipi_enable(IRQn_Type sgi){
+	IRQ_Enable(sgi);
+}
+
+// Disables receiving the SGI on the calling CPU
+void tru_ipi_disable(IRQn_Type sgi){
+	IRQ_Disable(sgi);
+}
+
+static void tru_ipi_mbox_isr(void){
+	uint32_t cpu = tru_cpu_id();
+	tru_ipi_mbox_handler_t handler = tru_ipi_mbox_handler[cpu];
+
+	for(uint32_t from = 0U; from < TRU_IPI_CPUS; from++){
+		tru_ipi_mbox_t *mbox = &tru_ipi_mbox[cpu][from];
+
+		if(mbox->full){
+			__DMB();  // The word is read after full, pairs with the DMB in tru_ipi_mbox_send()
+			uint32_t word = mbox->word;
+
+			__DMB();  // The word is read before the slot is freed
+			mbox->full = 0U;
+			if(handler != NULL) handler(from, word);
+		}
+	}
+}
+
+// Sets the mailbox handler of the calling CPU and enables its mailbox SGI
+void tru_ipi_mbox_init(tru_ipi_mbox_handler_t handler){
+	uint32_t cpu = tru_cpu_id();
+
+	for(uint32_t from = 0U; from < TRU_IPI_CPUS; from++) tru_ipi_mbox[cpu][from].full = 0U;
+	tru_ipi_mbox_handler[cpu] = handler;
+	tru_ipi_set_handler(TRU_IPI_MBOX_SGI, tru_ipi_mbox_isr);
+	tru_ipi_enable(TRU_IPI_MBOX_SGI);
+}
+
+/*
+	Sends a word to the mailbox of a CPU, which may be the calling CPU.
+	Returns 0 on success, or -1 if the previous word is not consumed yet.
+*/
+int tru_ipi_mbox_send(uint32_t cpu, uint32_t word){
+	tru_ipi_mbox_t *mbox = &tru_ipi_mbox[cpu][tru_cpu_id()];
+
+	if(mbox->full) return -1;
+
+	mbox->word = word;
+	__DMB();  // The word is written before the slot is marked full
+	mbox->full = 1U;
+	tru_ipi_send(TRU_IPI_MBOX_SGI, 1U << cpu);
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Inter-processor interrupts (IPI) between the two Cortex-A9 CPUs, using
+	the GIC software generated interrupts (SGI).
+
+	The handlers go in the shared CMSIS IRQTable and are called by
+	IRQ_Handler (irq_c5soc.c) on whichever CPU receives the SGI, use
+	tru_cpu_id() to tell them apart.  The SGI enable and priority registers
+	are banked per CPU, so tru_ipi_enable() must be called on each CPU that
+	wants to receive it, e.g. on CPU1 with tru_hps_smp_call_core1().
+
+	The mailbox sends a payload word with TRU_IPI_MBOX_SGI.  Each CPU has one
+	slot per sender, so a send fails while the previous word from the same
+	sender is not consumed yet.  The receiving CPU calls its mailbox handler
+	from the IRQ with the sender CPU and the word.
+
+	SGI numbers used elsewhere in this project:
+		- SGI1, SGI2: IRQ nesting benchmark (bench/bench_irq_nest.c)
+		- SGI3: FIQ latency benchmark (bench/bench_fiq.c)
+		- SGI4: deferred work benchmark (bench/bench_defer.c)
+		- SGI5: interrupt latency suite (bench/bench_irq_lat.c)
+		- SGI6: deferred work (tru_defer.h)
+		- SGI7: tru_ipi mailbox
+		- SGI8: AMP doorbell (c5soc/tru_c5soc_hps_amp.h)
+		- SGI9: coroutine scheduler wake up (tru_co.h)
+		- SGI10: coroutine benchmark (bench/bench_co.c)
+		- SGI11: FreeRTOS benchmark (bench/bench_freertos.c)
+		- SGI12: thread kernel reschedule (tru_thread.h)
+		- SGI13: thread kernel benchmark (bench/bench_thread.c)
+		- SGI15: OCRAM ISR latency benchmark (bench/bench_ocram.c)
+*/
+
+#ifndef TRU_IPI_H
+#define TRU_IPI_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+
+#define TRU_IPI_CPUS     2U
+#define TRU_IPI_MBOX_SGI SGI7_IRQn
+
+// GICD_SGIR target list filter
+#define TRU_IPI_FILTER_LIST   0U  // CPUs in the target list
+#define TRU_IPI_FILTER_OTHERS 1U  // All CPUs except the sender
+#define TRU_IPI_FILTER_SELF   2U  // Only the sender
+
+typedef void (*tru_ipi_mbox_handler_t)(uint32_t from_cpu, uint32_t word);
+
+void tru_ipi_set_handler(IRQn_Type sgi, IRQHandler_t handler);
+void tru_ipi_enable(IRQn_Type sgi);
+void tru_ipi_disable(IRQn_Type sgi);
+
+// Sends the SGI to the CPUs in cpu_mask, bit 0 = CPU0, bit 1 = CPU1
+static inline void tru_ipi_send(IRQn_Type sgi, uint32_t cpu_mask){
+	__DSB();  // Data written for the receiver is visible before the interrupt
+	GIC_SendSGI(sgi, cpu_mask, TRU_IPI_FILTER_LIST);
+}
+
+// Sends the SGI to all other CPUs
+static inline void tru_ipi_broadcast(IRQn_Type sgi){
+	__DSB();
+	GIC_SendSGI(sgi, 0U, TRU_IPI_FILTER_OTHERS);
+}
+
+// Sends the SGI to the calling CPU
+static inline void tru_ipi_send_self(IRQn_Type sgi){
+	__DSB();
+	GIC_SendSGI(sgi, 0U, TRU_IPI_FILTER_SELF);
+}
+
+void tru_ipi_mbox_init(tru_ipi_mbox_handler_t handler);
+int tru_ipi_mbox_send(uint32_t cpu, uint32_t word);
+
+#endif
+
+#endif
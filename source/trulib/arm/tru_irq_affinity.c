@@ -0,0 +1,195 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	GIC shared peripheral interrupt (SPI) affinity and load balancing.
+*/
+
+#include "tru_irq_affinity.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9_tlb.h"
+#include "tru_logger.h"
+#include <string.h>
+
+static uint32_t tru_irq_pinned[IRQ_GIC_LINE_COUNT / 32U];  // Bit set = not moved by tru_irq_rebalance()
+
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	TRU_TLB_LOCK_DATA tru_irq_stats_t tru_irq_stats[TRU_IRQ_CPUS][IRQ_GIC_LINE_COUNT];
+#endif
+
+static bool tru_irq_is_spi(IRQn_ID_t irqn){
+	return irqn >= (IRQn_ID_t)TRU_IRQ_SPI_FIRST && irqn < (IRQn_ID_t)IRQ_GIC_LINE_COUNT;
+}
+
+/*
+	Routes an SPI to the CPUs in cpu_mask, bit 0 = CPU0, bit 1 = CPU1.
+	Returns 0 on success, or -1 if it is not an SPI or the mask is empty.
+*/
+int tru_irq_set_affinity(IRQn_ID_t irqn, uint32_t cpu_mask){
+	cpu_mask &= (1U << TRU_IRQ_CPUS) - 1U;
+	if(!tru_irq_is_spi(irqn) || cpu_mask == 0U) return -1;
+
+	((volatile uint8_t *)GICDistributor->ITARGETSR)[irqn] = (uint8_t)cpu_mask;  // Byte access, no read-modify-write of the other SPIs
+
+	return 0;
+}
+
+// Returns the CPU mask an interrupt is routed to
+uint32_t tru_irq_get_affinity(IRQn_ID_t irqn){
+	return GIC_GetTarget((IRQn_Type)irqn);
+}
+
+// Excludes (or includes again) an SPI from tru_irq_rebalance()
+void tru_irq_pin(IRQn_ID_t irqn, bool pin){
+	if(!tru_irq_is_spi(irqn)) return;
+
+	if(pin){
+		tru_irq_pinned[irqn / 32U] |= 1UL << (irqn % 32U);
+	}else{
+		tru_irq_pinned[irqn / 32U] &= ~(1UL << (irqn % 32U));
+	}
+}
+
+static bool tru_irq_is_pinned(IRQn_ID_t irqn){
+	return tru_irq_pinned[irqn / 32U] & (1UL << (irqn % 32U));
+}
+
+// Counts the enabled SPIs routed to each CPU, an SPI routed to both is counted on both
+void tru_irq_get_distribution(uint32_t counts[TRU_IRQ_CPUS]){
+	memset(counts, 0, TRU_IRQ_CPUS * sizeof(counts[0]));
+
+	for(IRQn_ID_t irqn = TRU_IRQ_SPI_FIRST; irqn < (IRQn_ID_t)IRQ_GIC_LINE_COUNT; irqn++){
+		if(!IRQ_GetEnableState(irqn)) continue;
+
+		uint32_t target = tru_irq_get_affinity(irqn);
+		for(uint32_t cpu = 0U; cpu < TRU_IRQ_CPUS; cpu++){
+			if(target & (1U << cpu)) counts[cpu]++;
+		}
+	}
+}
+
+// Prints the target of each enabled SPI, and with TRU_IRQ_STATS the calls and average cycles per CPU
+void tru_irq_affinity_dump(void){
+	LOG("SPI affinity:\n");
+	for(IRQn_ID_t irqn = TRU_IRQ_SPI_FIRST; irqn < (IRQn_ID_t)IRQ_GIC_LINE_COUNT; irqn++){
+		if(!IRQ_GetEnableState(irqn)) continue;
+
+		LOG("  %3ld: cpu mask %lu%s", (long)irqn, (unsigned long)tru_irq_get_affinity(irqn), tru_irq_is_pinned(irqn) ? " pinned" : "");
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+		for(uint32_t cpu = 0U; cpu < TRU_IRQ_CPUS; cpu++){
+			const tru_irq_stats_t *s = &tru_irq_stats[cpu][irqn];
+			uint32_t avg = s->count ? (uint32_t)(s->cycles / s->count) : 0U;
+
+			LOG(", cpu%lu: %lu calls %lu avg %lu max cycles", (unsigned long)cpu, (unsigned long)s->count, (unsigned long)avg, (unsigned long)s->max);
+		}
+#endif
+		LOG("\n");
+	}
+}
+
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+
+// Starts the cycle counter and clears the statistics of the calling CPU
+void tru_irq_stats_init(void){
+	tru_pmu_ccnt_enable();
+	memset(tru_irq_stats[tru_cpu_id()], 0, sizeof(tru_irq_stats[0]));
+}
+
+// Clears the statistics of both CPUs.  Counts of handlers running at the same time on the other CPU may be lost
+void tru_irq_stats_reset(void){
+	memset(tru_irq_stats, 0, sizeof(tru_irq_stats));
+	__DMB();
+}
+
+// Returns the total handler cycles of an interrupt on both CPUs
+uint64_t tru_irq_stats_cycles(IRQn_ID_t irqn){
+	uint64_t cycles = 0U;
+
+	for(uint32_t cpu = 0U; cpu < TRU_IRQ_CPUS; cpu++) cycles += tru_irq_stats[cpu][irqn].cycles;
+
+	return cycles;
+}
+
+/*
+	Spreads the enabled, not pinned SPIs over the CPUs in cpu_mask by their
+	handler cycles, largest first onto the least loaded CPU.  Pinned SPIs
+	count towards the load of their first target CPU.  Statistics are not
+	reset.  Returns the number of SPIs moved, or -1 if the mask is empty.
+*/
+int tru_irq_rebalance(uint32_t cpu_mask){
+	static IRQn_ID_t spis[IRQ_GIC_LINE_COUNT - TRU_IRQ_SPI_FIRST];
+	uint64_t load[TRU_IRQ_CPUS] = { 0U };
+	uint32_t n = 0U;
+	int moved = 0;
+
+	cpu_mask &= (1U << TRU_IRQ_CPUS) - 1U;
+	if(cpu_mask == 0U) return -1;
+
+	// Collect the movable SPIs sorted by cycles (insertion sort, descending), and the load of the pinned ones
+	for(IRQn_ID_t irqn = TRU_IRQ_SPI_FIRST; irqn < (IRQn_ID_t)IRQ_GIC_LINE_COUNT; irqn++){
+		if(!IRQ_GetEnableState(irqn)) continue;
+
+		uint64_t cycles = tru_irq_stats_cycles(irqn);
+		if(tru_irq_is_pinned(irqn)){
+			uint32_t target = tru_irq_get_affinity(irqn);
+			for(uint32_t cpu = 0U; cpu < TRU_IRQ_CPUS; cpu++){
+				if(target & (1U << cpu)){
+					load[cpu] += cycles;
+					break;
+				}
+			}
+			continue;
+		}
+
+		uint32_t i = n++;
+		while(i > 0U && tru_irq_stats_cycles(spis[i - 1U]) < cycles){
+			spis[i] = spis[i - 1U];
+			i--;
+		}
+		spis[i] = irqn;
+	}
+
+	// Largest first onto the least loaded CPU
+	for(uint32_t i = 0U; i < n; i++){
+		uint32_t best = TRU_IRQ_CPUS;
+
+		for(uint32_t cpu = 0U; cpu < TRU_IRQ_CPUS; cpu++){
+			if((cpu_mask & (1U << cpu)) && (best == TRU_IRQ_CPUS || load[cpu] < load[best])) best = cpu;
+		}
+		load[best] += tru_irq_stats_cycles(spis[i]);
+
+		if(tru_irq_get_affinity(spis[i]) != (1U << best)){
+			tru_irq_set_affinity(spis[i], 1U << best);
+			moved++;
+		}
+	}
+
+	return moved;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,104 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	GIC shared peripheral interrupt (SPI) affinity and load balancing.
+
+	After GIC_Enable() every SPI targets CPU0.  tru_irq_set_affinity() routes
+	an SPI to another CPU (or both, then the first CPU to acknowledge it takes
+	it).  The target register is written as a byte, so it does not disturb
+	the other SPIs in the same word.  SGIs and PPIs are private to each CPU
+	and cannot be routed.
+
+	With TRU_IRQ_STATS IRQ_Handler (irq_c5soc.c) counts the calls and the
+	processor cycles of each handler per CPU, using the PMU cycle counter.
+	Call tru_irq_stats_init() on each CPU to start its cycle counter.
+	tru_irq_rebalance() then moves the enabled SPIs between the CPUs in a mask
+	so that the handler cycles are spread evenly, largest first.  SPIs marked
+	with tru_irq_pin() keep their target, e.g. the ones a control loop on a
+	CPU depends on, and a control loop CPU can be left out of the mask.
+
+	Notes:
+		- The IRQTable is shared, a handler moved to CPU1 must be safe to run
+		  there, e.g. no newlib calls (see c5soc/tru_c5soc_hps_smp.h)
+		- CPU1 must be started and have IRQ unmasked to service its SPIs
+
+	References:
+		- ARM Generic Interrupt Controller Architecture Specification v1.0
+		  Notable sections:
+		- Interrupt Processor Targets Registers, GICD_ITARGETSRn
+		- Cortex-A9 Technical Reference Manual
+		  Notable sections:
+		- Performance Monitor Control Register
+*/
+
+#ifndef TRU_IRQ_AFFINITY_H
+#define TRU_IRQ_AFFINITY_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_IRQ_CPUS      2U
+#define TRU_IRQ_SPI_FIRST 32U  // IDs below are SGIs and PPIs
+
+typedef struct{
+	uint32_t count;   // Number of handler calls
+	uint32_t max;     // Longest handler call in cycles
+	uint64_t cycles;  // Total handler cycles
+}tru_irq_stats_t;
+
+int tru_irq_set_affinity(IRQn_ID_t irqn, uint32_t cpu_mask);
+uint32_t tru_irq_get_affinity(IRQn_ID_t irqn);
+void tru_irq_pin(IRQn_ID_t irqn, bool pin);
+void tru_irq_get_distribution(uint32_t counts[TRU_IRQ_CPUS]);
+void tru_irq_affinity_dump(void);
+
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	extern tru_irq_stats_t tru_irq_stats[TRU_IRQ_CPUS][IRQ_GIC_LINE_COUNT];
+
+	// Called by IRQ_Handler after each handler call.  Each CPU only writes its own row
+	static inline void tru_irq_stats_add(IRQn_ID_t irqn, uint32_t cycles){
+		tru_irq_stats_t *s = &tru_irq_stats[tru_cpu_id()][irqn];
+
+		s->count++;
+		s->cycles += cycles;
+		if(cycles > s->max) s->max = cycles;
+	}
+
+	void tru_irq_stats_init(void);
+	void tru_irq_stats_reset(void);
+	uint64_t tru_irq_stats_cycles(IRQn_ID_t irqn);
+	int tru_irq_rebalance(uint32_t cpu_mask);
+#endif
+
+#endif
+
+#endif
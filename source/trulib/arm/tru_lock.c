@@ -0,0 +1,180 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Spinlock and ticket lock for the two Cortex-A9 CPUs.
+*/
+
+#include "tru_lock.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_atomic.h"
+
+#define TRU_TICKET_NEXT_INC 0x10000U  // Adds one to the next field of the ticket lock word
+
+// Masks IRQ and returns the previous mask
+static inline uint32_t tru_lock_irq_save(void){
+	uint32_t flags = __get_CPSR() & CPSR_I_Msk;
+
+	__disable_irq();
+	return flags;
+}
+
+// Unmasks IRQ if it was unmasked before tru_lock_irq_save()
+static inline void tru_lock_irq_restore(uint32_t flags){
+	if(!flags) __enable_irq();
+}
+
+// Wakes up the other CPU waiting in WFE
+static inline void tru_lock_wake(void){
+	__dsb();  // The release store must be visible before the event
+	__sev();
+}
+
+// ========
+// Spinlock
+// ========
+
+void tru_spin_init(tru_spinlock_t *lock){
+	lock->val = 0U;
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires = 0U;
+	lock->stats.contended = 0U;
+	lock->stats.waits = 0U;
+#endif
+}
+
+void tru_spin_lock(tru_spinlock_t *lock){
+	uint32_t waits = 0U;
+
+	while(tru_atomic_xchg(&lock->val, 1U) != 0U){
+		// Wait with plain reads until it looks free, an SEV between the read and the WFE makes the WFE fall through
+		while(lock->val != 0U){
+			waits++;
+			__wfe();
+		}
+	}
+
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires++;
+	if(waits) lock->stats.contended++;
+	lock->stats.waits += waits;
+#else
+	(void)waits;
+#endif
+}
+
+bool tru_spin_trylock(tru_spinlock_t *lock){
+	if(lock->val != 0U || tru_atomic_xchg(&lock->val, 1U) != 0U) return false;
+
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires++;
+#endif
+	return true;
+}
+
+void tru_spin_unlock(tru_spinlock_t *lock){
+	tru_atomic_store(&lock->val, 0U);
+	tru_lock_wake();
+}
+
+uint32_t tru_spin_lock_irqsave(tru_spinlock_t *lock){
+	uint32_t flags = tru_lock_irq_save();
+
+	tru_spin_lock(lock);
+	return flags;
+}
+
+void tru_spin_unlock_irqrestore(tru_spinlock_t *lock, uint32_t flags){
+	tru_spin_unlock(lock);
+	tru_lock_irq_restore(flags);
+}
+
+// ===========
+// Ticket lock
+// ===========
+
+void tru_ticket_init(tru_ticketlock_t *lock){
+	lock->val = 0U;
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires = 0U;
+	lock->stats.contended = 0U;
+	lock->stats.waits = 0U;
+#endif
+}
+
+void tru_ticket_lock(tru_ticketlock_t *lock){
+	uint32_t waits = 0U;
+	uint16_t ticket = (uint16_t)((tru_atomic_add(&lock->val, TRU_TICKET_NEXT_INC) - TRU_TICKET_NEXT_INC) >> 16U);
+
+	while(lock->tickets.owner != ticket){
+		waits++;
+		__wfe();
+	}
+	__dmb();  // Accesses in the critical section are not done before the owner is seen
+
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires++;
+	if(waits) lock->stats.contended++;
+	lock->stats.waits += waits;
+#else
+	(void)waits;
+#endif
+}
+
+bool tru_ticket_trylock(tru_ticketlock_t *lock){
+	uint32_t val = lock->val;
+
+	// Held or waited on?
+	if((val & 0xffffU) != (val >> 16U)) return false;
+	if(!tru_atomic_cas(&lock->val, val, val + TRU_TICKET_NEXT_INC)) return false;
+
+#if TRU_LOCK_STATS == 1U
+	lock->stats.acquires++;
+#endif
+	return true;
+}
+
+void tru_ticket_unlock(tru_ticketlock_t *lock){
+	__dmb();  // The critical section is done before the lock is handed over
+	lock->tickets.owner++;  // Only the holder writes the owner field
+	tru_lock_wake();
+}
+
+uint32_t tru_ticket_lock_irqsave(tru_ticketlock_t *lock){
+	uint32_t flags = tru_lock_irq_save();
+
+	tru_ticket_lock(lock);
+	return flags;
+}
+
+void tru_ticket_unlock_irqrestore(tru_ticketlock_t *lock, uint32_t flags){
+	tru_ticket_unlock(lock);
+	tru_lock_irq_restore(flags);
+}
+
+#endif
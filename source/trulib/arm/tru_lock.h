@@ -0,0 +1,108 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Spinlock and ticket lock for the two Cortex-A9 CPUs.
+
+	tru_spinlock_t is a test-and-test-and-set lock: cheapest when there is
+	little contention, but when both CPUs keep taking it, it is not fair.
+	tru_ticketlock_t hands the lock out in the order it was asked for, so a
+	waiter cannot starve.  Both wait with WFE and the unlock wakes the other
+	CPU with SEV, so a waiter does not hammer the cache line.
+
+	The _irqsave variants also mask IRQ on the calling CPU, use them for locks
+	that are also taken in an IRQ handler, otherwise the handler can spin on
+	a lock held by the code it interrupted.
+
+	With TRU_LOCK_STATS (default on in DEBUG builds) each lock counts the
+	acquires, how many had to wait and the number of waits, updated by the
+	holder so they need no atomics.
+
+	See tru_atomic.h for the memory requirements between the CPUs.
+*/
+
+#ifndef TRU_LOCK_H
+#define TRU_LOCK_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(TRU_LOCK_STATS)
+	#ifdef DEBUG
+		#define TRU_LOCK_STATS 1U
+	#else
+		#define TRU_LOCK_STATS 0U
+	#endif
+#endif
+
+typedef struct{
+	uint32_t acquires;   // Number of times the lock was taken
+	uint32_t contended;  // Number of times the lock was already held
+	uint32_t waits;      // Number of WFE waits
+}tru_lock_stats_t;
+
+typedef struct{
+	volatile uint32_t val;  // 0 = free, 1 = held
+#if TRU_LOCK_STATS == 1U
+	tru_lock_stats_t stats;
+#endif
+}tru_spinlock_t;
+
+typedef struct{
+	union{
+		volatile uint32_t val;
+		struct{
+			volatile uint16_t owner;  // Ticket being served
+			volatile uint16_t next;   // Next ticket to hand out
+		}tickets;
+	};
+#if TRU_LOCK_STATS == 1U
+	tru_lock_stats_t stats;
+#endif
+}tru_ticketlock_t;
+
+#define TRU_SPINLOCK_INIT   { 0 }
+#define TRU_TICKETLOCK_INIT { { 0 } }
+
+void tru_spin_init(tru_spinlock_t *lock);
+void tru_spin_lock(tru_spinlock_t *lock);
+bool tru_spin_trylock(tru_spinlock_t *lock);
+void tru_spin_unlock(tru_spinlock_t *lock);
+uint32_t tru_spin_lock_irqsave(tru_spinlock_t *lock);
+void tru_spin_unlock_irqrestore(tru_spinlock_t *lock, uint32_t flags);
+
+void tru_ticket_init(tru_ticketlock_t *lock);
+void tru_ticket_lock(tru_ticketlock_t *lock);
+bool tru_ticket_trylock(tru_ticketlock_t *lock);
+void tru_ticket_unlock(tru_ticketlock_t *lock);
+uint32_t tru_ticket_lock_irqsave(tru_ticketlock_t *lock);
+void tru_ticket_unlock_irqrestore(tru_ticketlock_t *lock, uint32_t flags);
+
+#endif
+
+#endif
@@ -0,0 +1,111 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Lazy VFP/NEON context save for IRQ_Handler (irq_c5soc.c).
+*/
+
+#include "tru_vfp_lazy.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#if TRU_VFP_LAZY_ENABLED == 1U
+
+#include "tru_cortex_a9_tlb.h"
+
+TRU_TLB_LOCK_DATA tru_vfp_lazy_frame_t *tru_vfp_lazy_pending[TRU_VFP_LAZY_CPUS];  // Frame waiting for the first VFP use, NULL if none
+TRU_TLB_LOCK_DATA uint32_t tru_vfp_lazy_irq_fp[IRQ_GIC_LINE_COUNT / 32U];           // Bit set = handler uses the VFP, save before calling it
+
+/*
+	Enables the VFP and saves its registers into the pending frame of the
+	calling CPU.  Called by Undef_Handler and by IRQ_Handler for handlers
+	marked with tru_vfp_lazy_set_irq().  Only uses r0-r3 and r12.
+	Returns 1 if saved, or 0 if the VFP is already enabled or there is no
+	pending frame.
+*/
+TRU_TLB_LOCK_TEXT __attribute__((naked)) uint32_t tru_vfp_lazy_save(void){
+	__ASM volatile(
+		"VMRS   r0, fpexc                     \n"
+		"TST    r0, #0x40000000               \n"  // Already enabled?
+		"MOVNE  r0, #0                        \n"
+		"BXNE   lr                            \n"
+		"MRC    p15, 0, r1, c0, c0, 5         \n"  // CPU ID from MPIDR
+		"AND    r1, r1, #3                    \n"
+		"LDR    r2, =tru_vfp_lazy_pending     \n"
+		"LDR    r3, [r2, r1, LSL #2]          \n"
+		"CMP    r3, #0                        \n"  // No pending frame?
+		"MOVEQ  r0, #0                        \n"
+		"BXEQ   lr                            \n"
+		"ORR    r0, r0, #0x40000000           \n"  // Enable the VFP
+		"VMSR   fpexc, r0                     \n"
+		"VMRS   r0, fpscr                     \n"
+		"STR    r0, [r3, #12]                 \n"
+		"ADD    r12, r3, #16                  \n"
+		"VSTMIA r12!, {d0-d15}                \n"
+		"VSTMIA r12!, {d16-d31}               \n"
+		"MOV    r0, #1                        \n"
+		"STR    r0, [r3, #8]                  \n"  // Mark saved
+		"MOV    r0, #0                        \n"
+		"STR    r0, [r2, r1, LSL #2]          \n"  // No longer pending
+		"MOV    r0, #1                        \n"
+		"BX     lr                            \n"
+	);
+}
+
+/*
+	Undefined instruction handler.  A VFP/NEON instruction with FPEXC.EN
+	cleared by IRQ_Handler saves the context and returns to re-execute it.
+	Anything else goes to Default_Handler.
+*/
+TRU_TLB_LOCK_TEXT __attribute__((naked)) void Undef_Handler(void){
+	__ASM volatile(
+		"PUSH   {r0-r3, r12, lr}              \n"
+		"BL     tru_vfp_lazy_save             \n"
+		"CMP    r0, #0                        \n"
+		"POP    {r0-r3, r12, lr}              \n"  // Does not change the flags
+		"BEQ    Default_Handler               \n"  // Not a lazy VFP trap
+		"PUSH   {r0}                          \n"
+		"MRS    r0, spsr                      \n"
+		"TST    r0, #0x20                     \n"  // Thumb state?
+		"POP    {r0}                          \n"
+		"SUBNE  lr, lr, #2                    \n"
+		"SUBEQ  lr, lr, #4                    \n"
+		"MOVS   pc, lr                        \n"  // Return to the trapped instruction
+	);
+}
+
+// Marks the handler of an interrupt as using the VFP, so the context is saved before the call instead of on the first use
+void tru_vfp_lazy_set_irq(IRQn_ID_t irqn, bool uses_fp){
+	if(irqn < 0 || irqn >= (IRQn_ID_t)IRQ_GIC_LINE_COUNT) return;
+
+	if(uses_fp){
+		tru_vfp_lazy_irq_fp[irqn / 32U] |= 1UL << (irqn % 32U);
+	}else{
+		tru_vfp_lazy_irq_fp[irqn / 32U] &= ~(1UL << (irqn % 32U));
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,145 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Lazy VFP/NEON context save for IRQ_Handler (irq_c5soc.c).
+
+	Without it IRQ_Handler saves and restores FPSCR and d0-d31 (260 bytes) on
+	every interrupt.  With TRU_LAZY_VFP it only reserves a frame on the IRQ
+	stack, records it as pending for the CPU and clears FPEXC.EN.  The first
+	VFP/NEON instruction in the handler then traps to Undef_Handler, which
+	enables the VFP again, saves the registers into the pending frame and
+	re-executes the instruction.  On exit IRQ_Handler restores the registers
+	only if they were saved, and restores FPEXC.  An integer-only handler
+	pays for two FPEXC accesses instead of the full save and restore.
+
+	Handlers known to use the VFP can be marked with tru_vfp_lazy_set_irq(),
+	then the registers are saved before the handler is called, which avoids
+	the cost of the trap.
+
+	The frame records the previous pending frame, so it works with nested
+	interrupts: each level saves whatever the VFP registers hold when it
+	first uses them.
+
+	Notes:
+		- An undefined instruction that is not a lazy VFP trap goes to
+		  Default_Handler, as before
+		- The compiler may use the VFP registers in any C code, e.g. for
+		  struct copies, which also traps and saves correctly
+
+	References:
+		- Arm Architecture Reference Manual Armv7-A and Armv7-R edition
+		  Notable sections:
+		- Floating-Point Exception Control register, FPEXC
+		- Enabling Advanced SIMD and floating-point support
+*/
+
+#ifndef TRU_VFP_LAZY_H
+#define TRU_VFP_LAZY_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U && defined(TRU_LAZY_VFP) && TRU_LAZY_VFP == 1U
+	#define TRU_VFP_LAZY_ENABLED 1U
+#else
+	#define TRU_VFP_LAZY_ENABLED 0U
+#endif
+
+#define TRU_VFP_LAZY_CPUS       2U
+#define TRU_VFP_LAZY_FPEXC_EN   0x40000000U
+
+// Frame on the IRQ stack, the offsets are used by the assembly below
+typedef struct{
+	uint32_t fpexc;   // 0: FPEXC of the interrupted code
+	void *prev;       // 4: Previous pending frame of this CPU
+	uint32_t saved;   // 8: 1 = the registers below hold the interrupted VFP context
+	uint32_t fpscr;   // 12
+	uint64_t d[32];   // 16
+}tru_vfp_lazy_frame_t;
+
+#define TRU_VFP_LAZY_FRAME_SIZE 272U  // sizeof(tru_vfp_lazy_frame_t), keeps the stack 8 byte aligned
+
+#if TRU_VFP_LAZY_ENABLED == 1U
+	extern tru_vfp_lazy_frame_t *tru_vfp_lazy_pending[TRU_VFP_LAZY_CPUS];
+	extern uint32_t tru_vfp_lazy_irq_fp[IRQ_GIC_LINE_COUNT / 32U];
+
+	// IRQ entry: reserve the frame, make it the pending one and disable the VFP.  Uses r0-r3
+	#define TRU_VFP_LAZY_ENTRY_ASM \
+		"SUB    sp, sp, #272                  \n" \
+		"VMRS   r0, fpexc                     \n" \
+		"STR    r0, [sp, #0]                  \n" \
+		"MRC    p15, 0, r1, c0, c0, 5         \n" \
+		"AND    r1, r1, #3                    \n" \
+		"LDR    r2, =tru_vfp_lazy_pending     \n" \
+		"LDR    r3, [r2, r1, LSL #2]          \n" \
+		"STR    r3, [sp, #4]                  \n" \
+		"MOV    r3, #0                        \n" \
+		"STR    r3, [sp, #8]                  \n" \
+		"MOV    r3, sp                        \n" \
+		"STR    r3, [r2, r1, LSL #2]          \n" \
+		"BIC    r0, r0, #0x40000000           \n" \
+		"VMSR   fpexc, r0                     \n"
+
+	// IRQ exit: restore the registers if they were saved, the previous pending frame and FPEXC, then free the frame.  Uses r0-r3
+	#define TRU_VFP_LAZY_EXIT_ASM \
+		"LDR    r0, [sp, #8]                  \n" \
+		"CMP    r0, #0                        \n" \
+		"BEQ    1f                            \n" \
+		"ADD    r1, sp, #16                   \n" \
+		"VLDMIA r1!, {d0-d15}                 \n" \
+		"VLDMIA r1!, {d16-d31}                \n" \
+		"LDR    r0, [sp, #12]                 \n" \
+		"VMSR   fpscr, r0                     \n" \
+		"1:                                   \n" \
+		"MRC    p15, 0, r1, c0, c0, 5         \n" \
+		"AND    r1, r1, #3                    \n" \
+		"LDR    r2, =tru_vfp_lazy_pending     \n" \
+		"LDR    r3, [sp, #4]                  \n" \
+		"STR    r3, [r2, r1, LSL #2]          \n" \
+		"LDR    r0, [sp, #0]                  \n" \
+		"VMSR   fpexc, r0                     \n" \
+		"ADD    sp, sp, #272                  \n"
+
+	#define TRU_VFP_LAZY_IRQ_ENTRY() __ASM volatile(TRU_VFP_LAZY_ENTRY_ASM ::: "r0", "r1", "r2", "r3", "memory")
+	#define TRU_VFP_LAZY_IRQ_EXIT()  __ASM volatile(TRU_VFP_LAZY_EXIT_ASM ::: "r0", "r1", "r2", "r3", "memory", "cc")
+
+	// Returns true if the handler of the interrupt is marked as using the VFP
+	static inline bool tru_vfp_lazy_irq_uses_fp(IRQn_ID_t irqn){
+		return tru_vfp_lazy_irq_fp[irqn / 32U] & (1UL << (irqn % 32U));
+	}
+
+	uint32_t tru_vfp_lazy_save(void);
+	void tru_vfp_lazy_set_irq(IRQn_ID_t irqn, bool uses_fp);
+#endif
+
+#endif
+
+#endif
@@ -25,6 +25,9 @@
 */
 
 #include "tru_bsp_c5soc_custom.h"
+#include "tru_boot_ts.h"
+#include "tru_time.h"
+#include "tru_c5soc_hps_clkmgr.h"
 
 #if(TRU_BOARD == TRU_BOARD_C5SOC_CUSTOM)
 
@@ -46,9 +49,24 @@
 #endif
 
 void tru_bsp_init(void){
+	tru_boot_ts_mark(TRU_BOOT_TS_BSP_INIT);
+
 	#ifdef SEMIHOSTING
 		initialise_monitor_handles();  // Initialise Semihosting
 	#endif
+
+	tru_time_init();  // Calibrate the time conversions from the clock configuration
+
+	#if !defined(SEMIHOSTING) && ((defined(TRU_PRINT_UART0) && TRU_PRINT_UART0 == 1U) || (defined(TRU_PRINT_UART1) && TRU_PRINT_UART1 == 1U))
+		// The divisor from the running l4_sp clock, rather than relying on the preloader's clock configuration
+		#if TRU_PRINT_UART0 == 1U
+			tru_hps_uart_ll_set_baud((void *)TRU_HPS_UART0_BASE, tru_hps_clkmgr_get_l4_sp_hz(), TRU_HPS_UART_BAUD);
+		#elif TRU_PRINT_UART1 == 1U
+			tru_hps_uart_ll_set_baud((void *)TRU_HPS_UART1_BASE, tru_hps_clkmgr_get_l4_sp_hz(), TRU_HPS_UART_BAUD);
+		#endif
+	#endif
+
+	tru_boot_ts_mark(TRU_BOOT_TS_BSP_INIT_END);
 }
 
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
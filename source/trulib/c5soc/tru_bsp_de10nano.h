@@ -38,6 +38,7 @@
 #include "tru_c5soc_hps_uart_ll.h"
 
 #define TRU_HPS_INPUT_CLK_HZ 25000000
+#define TRU_HPS_UART_BAUD    115200U  // Console UART, the same as U-Boot
 
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
 	extern int uboot_argc;
@@ -0,0 +1,169 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FreeRTOS glue for the Cyclone V SoC HPS, see tru_c5soc_freertos.h.
+*/
+
+#include "tru_c5soc_freertos.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC) && defined(TRU_FREERTOS) && TRU_FREERTOS == 1U
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "irq_c5soc.h"
+#include "arm/tru_cortex_a9.h"
+#include "tru_time.h"
+#include <stdio.h>
+
+// Port entry points (portASM.S and port.c)
+extern void FreeRTOS_IRQ_Handler(void);
+extern void FreeRTOS_SWI_Handler(void);
+extern void FreeRTOS_Tick_Handler(void);
+
+// Private timer counts per tick, the timers run at PERIPHCLK = CPU clock / 4
+static uint32_t tru_freertos_tick_cnt;
+
+// Overrides the weak CMSIS handler (irq_ctrl_gic.c), the port acknowledges the interrupt and calls vApplicationIRQHandler
+__attribute__((naked)) void IRQ_Handler(void){
+	__asm__ volatile("B FreeRTOS_IRQ_Handler \n");
+}
+
+// Overrides the startup default handler, the port yields with SVC 0
+__attribute__((naked)) void SVC_Handler(void){
+	__asm__ volatile("B FreeRTOS_SWI_Handler \n");
+}
+
+// Called by the port's vApplicationIRQHandler after the VFP registers are saved, with the ICCIAR value
+void vApplicationFPUSafeIRQHandler(uint32_t ulICCIAR){
+	irq_dispatch_id((IRQn_ID_t)ulICCIAR);
+}
+
+void tru_freertos_assert(const char *file, int line){
+	taskDISABLE_INTERRUPTS();
+	printf("FreeRTOS assert: %s: %i\n", file, line);
+	while(1);
+}
+
+// The global timer comparator IRQ only needs to end the WFI of the tickless idle
+static void tru_freertos_idle_isr(void){
+	gtim_disarm_compare();
+	gtim_clear_event();
+}
+
+// Sets the GIC binary point so the FreeRTOS priorities map to irq_set_group_priority(), call before vTaskStartScheduler()
+void tru_freertos_init(void){
+	IRQ_SetPriorityGroupBits(TRU_FREERTOS_BINARY_POINT_GRP_BITS);
+
+	tru_time_ensure_started();
+
+	irq_set_group_priority(TRU_FREERTOS_IDLE_IRQ, TRU_FREERTOS_IRQ_PRIORITY_LOWEST, 0U);
+	IRQ_SetHandler(TRU_FREERTOS_IDLE_IRQ, tru_freertos_idle_isr);
+	IRQ_Enable(TRU_FREERTOS_IDLE_IRQ);
+}
+
+// Called by xPortStartScheduler() (configSETUP_TICK_INTERRUPT)
+void vConfigureTickInterrupt(void){
+	tru_freertos_tick_cnt = SystemCoreClock / 4U / configTICK_RATE_HZ;
+
+	ptim_setup_basic_mode();
+	PTIM_REG->load = tru_freertos_tick_cnt - 1U;
+	ptim_clear_event();
+	PTIM_REG->control.val |= PTIM_CONTROL_AUTORELOAD_MSK | PTIM_CONTROL_IRQ_ENABLE_MSK;
+
+	irq_set_group_priority(TRU_FREERTOS_TICK_IRQ, TRU_FREERTOS_IRQ_PRIORITY_LOWEST, 0U);
+	IRQ_SetHandler(TRU_FREERTOS_TICK_IRQ, FreeRTOS_Tick_Handler);
+	IRQ_Enable(TRU_FREERTOS_TICK_IRQ);
+	ptim_enable();
+}
+
+// Called by FreeRTOS_Tick_Handler() (configCLEAR_TICK_INTERRUPT)
+void vClearTickInterrupt(void){
+	ptim_clear_event();
+}
+
+// ==================
+// Tickless idle mode
+// ==================
+
+// Called by the idle task with the scheduler suspended (portSUPPRESS_TICKS_AND_SLEEP).  The private timer is stopped and
+// the global timer comparator is armed for the end of the expected idle time, on the same PERIPHCLK timebase.  On wake up
+// the kernel tick count is stepped by the whole ticks slept and the private timer restarted for the rest of the current
+// tick.  The last tick of the idle time is left to the tick interrupt, so the kernel unblocks the task as usual.
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime){
+	uint32_t left;
+	uint32_t ticks = 0U;
+	uint64_t elapsed;
+	uint64_t start;
+	uint64_t wake;
+
+	__disable_irq();  // An IRQ that arrives from here on still ends the WFI
+
+	// A task became ready or the tick is already due, do not sleep
+	if(eTaskConfirmSleepModeStatus() == eAbortSleep || PTIM_REG->intrstatus.bits.eventflag){
+		__enable_irq();
+		return;
+	}
+
+	ptim_disable();
+	left = PTIM_REG->counter + 1U;  // Counts to the next tick
+	start = gtim_get_counter();
+
+	wake = start + left + (uint64_t)(xExpectedIdleTime - 1U) * tru_freertos_tick_cnt;
+	gtim_arm_compare(wake);
+
+	__DSB();
+	__WFI();
+
+	elapsed = gtim_get_counter() - start;
+
+	// Woken by the comparator or another IRQ
+	gtim_disarm_compare();
+	gtim_clear_event();
+
+	if(elapsed < left){
+		left -= (uint32_t)elapsed;  // Still within the current tick
+	}else{
+		elapsed -= left;
+		ticks = (uint32_t)(1U + elapsed / tru_freertos_tick_cnt);
+		left = tru_freertos_tick_cnt - (uint32_t)(elapsed % tru_freertos_tick_cnt);
+
+		// Overslept, e.g. the IRQ latency, let the tick interrupt deliver the last one now
+		if(ticks >= xExpectedIdleTime){
+			ticks = xExpectedIdleTime - 1U;
+			left = 1U;
+		}
+	}
+
+	PTIM_REG->counter = left - 1U;
+	ptim_enable();
+
+	if(ticks){
+		vTaskStepTick(ticks);
+	}
+
+	__enable_irq();
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	FreeRTOS glue for the Cyclone V SoC HPS (make rtos=freertos).
+
+	The GCC ARM_CA9 port of the FreeRTOS-Kernel (not part of this tree, see
+	FREERTOS_PATH in Makefile-app1.mk) runs on CPU0.  The build defines
+	TRU_FREERTOS == 1U, which makes the CMSIS IRQ_Handler weak (see
+	tru_config.h), and this file supplies:
+		- IRQ_Handler and SVC_Handler, forwarding to the port's
+		  FreeRTOS_IRQ_Handler and FreeRTOS_SWI_Handler
+		- vApplicationFPUSafeIRQHandler, which dispatches the acknowledged
+		  interrupt to the CMSIS IRQTable and context handlers with
+		  irq_dispatch_id(), so IRQ_SetHandler() and irq_set_ctx_handler()
+		  work as without the kernel.  The port's weak vApplicationIRQHandler
+		  saves the VFP registers before calling it
+		- The tick from the Cortex-A9 private timer (PPI 29) at the lowest
+		  usable priority
+		- Tickless idle: the private timer is stopped and the global timer
+		  comparator (PPI 27) wakes the CPU for the next timeout
+
+	Interrupt priorities:
+		tru_freertos_init() sets binary point 2, so the group priority of
+		irq_set_group_priority() is the FreeRTOS interrupt priority (0 to 31,
+		the GIC implements 5 bits).  The kernel masks priorities 18 to 31
+		(configMAX_API_CALL_INTERRUPT_PRIORITY) in its critical sections,
+		only handlers at those priorities may call the FromISR API.  A
+		handler at 0 to 17 is never delayed by the kernel but must not call
+		it.  The handlers are nested by priority, the port re-enables the IRQ
+		after the acknowledge.
+
+	Usage:
+		tru_freertos_init();
+		xTaskCreate(...);
+		irq_set_group_priority(irqn, TRU_FREERTOS_IRQ_PRIORITY_DEFAULT, 0U);
+		IRQ_SetHandler(irqn, handler);
+		IRQ_Enable(irqn);
+		vTaskStartScheduler();  // Does not return
+
+	Notes:
+		- The global timer comparator of CPU0 belongs to the tickless idle,
+		  tru_co cannot run on CPU0 in this build
+		- The global timer must not be stopped or reset while the kernel
+		  runs
+*/
+
+#ifndef TRU_C5SOC_FREERTOS_H
+#define TRU_C5SOC_FREERTOS_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC) && defined(TRU_FREERTOS) && TRU_FREERTOS == 1U
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+
+#define TRU_FREERTOS_TICK_IRQ             SecurePhyTimer_IRQn  // Cortex-A9 private timer PPI
+#define TRU_FREERTOS_IDLE_IRQ             VirtualTimer_IRQn    // Cortex-A9 global timer PPI
+#define TRU_FREERTOS_BINARY_POINT_GRP_BITS 5U                  // Binary point 2, 5 group priority bits
+#define TRU_FREERTOS_IRQ_PRIORITY_LOWEST  30U                  // The tick, 31 is the idle priority mask
+#define TRU_FREERTOS_IRQ_PRIORITY_DEFAULT 24U                  // A handler that calls the FromISR API
+
+void tru_freertos_init(void);
+
+#endif
+
+#endif
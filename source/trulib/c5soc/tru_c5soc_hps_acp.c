@@ -0,0 +1,124 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_c5soc_hps_acp.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "arm/tru_cortex_a9.h"
+#include <stddef.h>
+
+extern uint32_t __acp_pool_start;  // Reference external symbol name from the linker file
+extern uint32_t __acp_buffer_end;  // Reference external symbol name from the linker file
+
+static uint32_t tru_hps_acp_next;  // Next free address of the ACP pool, 0 = not initialised
+
+static inline uint32_t tru_hps_acp_map_val(uint32_t page, uint32_t user){
+	return ((page << TRU_HPS_ACPIDMAP_PAGE_POS) & TRU_HPS_ACPIDMAP_PAGE_MSK) | ((user << TRU_HPS_ACPIDMAP_USER_POS) & TRU_HPS_ACPIDMAP_USER_MSK);
+}
+
+/*
+	Sets the page and AxUSER attributes for the dynamically mapped IDs, i.e. any
+	master that is not assigned to a fixed virtual ID.  This is normally the case
+	for masters from the FPGA.
+*/
+void tru_hps_acp_set_dynamic(uint32_t page, uint32_t user){
+	uint32_t val = tru_hps_acp_map_val(page, user);
+
+	TRU_HPS_ACPIDMAP_REG->dynrd = val;
+	TRU_HPS_ACPIDMAP_REG->dynwr = val;
+}
+
+/*
+	Maps a master ID to one of the fixed virtual IDs (2 to 6) with the page and
+	AxUSER attributes.  Returns 0 on success, or -1 if vid is out of range.
+*/
+int tru_hps_acp_set_fixed(uint32_t vid, uint32_t mid, uint32_t page, uint32_t user){
+	if(vid < TRU_HPS_ACPIDMAP_VID_FIRST || vid > TRU_HPS_ACPIDMAP_VID_LAST) return -1;
+
+	volatile uint32_t *reg = &TRU_HPS_ACPIDMAP_REG->vid2rd + (vid - TRU_HPS_ACPIDMAP_VID_FIRST) * 2U;  // Each virtual ID has a read and write register pair
+	uint32_t val = TRU_HPS_ACPIDMAP_FORCE_MSK | ((mid << TRU_HPS_ACPIDMAP_MID_POS) & TRU_HPS_ACPIDMAP_MID_MSK) | tru_hps_acp_map_val(page, user);
+
+	reg[0] = val;  // Read
+	reg[1] = val;  // Write
+
+	return 0;
+}
+
+/*
+	Checks the CPU settings needed for the ACP to be coherent with the L1 data
+	cache.  With the data cache disabled there is nothing to be coherent with.
+*/
+bool tru_hps_acp_is_coherent(void){
+	if((__get_SCTLR() & SCTLR_C_Msk) == 0U) return true;
+
+	return (__get_ACTLR() & ACTLR_SMP_Msk) && scu_is_enabled();
+}
+
+/*
+	Sets up the dynamic ID mapping for coherent (write-back write-allocate,
+	shared) accesses to the page where the ACP buffer block is located, and
+	resets the allocator.
+*/
+void tru_hps_acp_init(void){
+	tru_hps_acp_set_dynamic(tru_hps_acp_page(&__acp_pool_start), TRU_HPS_ACP_USER_WBWA_SHARED);
+	tru_hps_acp_free_all();
+}
+
+/*
+	Simple bump allocator from the ACP pool, the size is rounded up to the cache
+	line size so two buffers never share a cache line.  Returns NULL when the
+	pool is exhausted.  Note, it is not thread or interrupt safe.
+*/
+void *tru_hps_acp_alloc(uint32_t size){
+	uint32_t addr;
+	uint32_t limit = (uint32_t)&__acp_buffer_end;
+
+	if(tru_hps_acp_next == 0U) tru_hps_acp_free_all();
+
+	size = (size + TRU_HPS_ACP_ALIGN - 1U) & ~(TRU_HPS_ACP_ALIGN - 1U);
+	addr = tru_hps_acp_next;
+	if(size == 0U || size > limit - addr) return NULL;
+
+	tru_hps_acp_next = addr + size;
+
+	return (void *)addr;
+}
+
+// Releases all allocations at once
+void tru_hps_acp_free_all(void){
+	tru_hps_acp_next = ((uint32_t)&__acp_pool_start + TRU_HPS_ACP_ALIGN - 1U) & ~(TRU_HPS_ACP_ALIGN - 1U);
+}
+
+uint32_t tru_hps_acp_get_free(void){
+	if(tru_hps_acp_next == 0U) tru_hps_acp_free_all();
+
+	return (uint32_t)&__acp_buffer_end - tru_hps_acp_next;
+}
+
+#endif
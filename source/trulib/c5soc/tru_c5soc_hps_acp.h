@@ -0,0 +1,138 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Accelerator Coherency Port (ACP) support for Cyclone V SoC HPS.
+
+	The ACP is a slave port on the SCU which lets an external master (e.g. a DMA
+	engine inside the FPGA through the FPGA-to-HPS bridge) read and write
+	memory coherently with the Cortex-A9 L1 data caches.  A master accesses a
+	buffer through the 1GB ACP window at 0x80000000, instead of the SDRAM
+	address, and the CPU does not need any explicit cache maintenance from
+	tru_cache.h.
+
+	Requirements:
+		- SCU enabled and ACTLR.SMP bit set (TRU_SCU == 1U and
+		  TRU_SMP_COHERENCY == 1U), otherwise the cached lines are not snooped
+		- The FPGA master should drive AxCACHE as cacheable (e.g. 0b1111)
+		- The FPGA-to-HPS bridge is enabled and out of reset
+
+	References:
+		- Cyclone V Hard Processor System Technical Reference Manual
+		  Notable sections:
+		- Accelerator Coherency Port
+		- ACP ID Mapper
+		- Cortex-A9 MPCore Technical Reference Manual
+		  Notable sections:
+		- 2.4 Accelerator Coherency Port
+*/
+
+#ifndef TRU_C5SOC_HPS_ACP_H
+#define TRU_C5SOC_HPS_ACP_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ACP address window as seen from the L3 interconnect (FPGA-to-HPS bridge and other L3 masters)
+#define TRU_HPS_ACP_WINDOW_BASE 0x80000000UL
+#define TRU_HPS_ACP_WINDOW_SIZE 0x40000000UL  // 1GB, the page field of the ID mapper selects which 1GB of the 4GB address space
+#define TRU_HPS_ACP_ALIGN       32U           // Allocations are aligned to the L1/L2 cache line size
+
+// ACP ID mapper registers
+#define TRU_HPS_ACPIDMAP_BASE   0xff707000UL
+
+#define TRU_HPS_ACPIDMAP_USER_POS  4U
+#define TRU_HPS_ACPIDMAP_USER_MSK  (0x1fUL << TRU_HPS_ACPIDMAP_USER_POS)
+#define TRU_HPS_ACPIDMAP_PAGE_POS  12U
+#define TRU_HPS_ACPIDMAP_PAGE_MSK  (0x3UL << TRU_HPS_ACPIDMAP_PAGE_POS)
+#define TRU_HPS_ACPIDMAP_MID_POS   16U
+#define TRU_HPS_ACPIDMAP_MID_MSK   (0xfffUL << TRU_HPS_ACPIDMAP_MID_POS)
+#define TRU_HPS_ACPIDMAP_FORCE_POS 31U
+#define TRU_HPS_ACPIDMAP_FORCE_MSK (0x1UL << TRU_HPS_ACPIDMAP_FORCE_POS)
+
+// AxUSER values driven to the ACP: bits[4:1] = inner attributes, bit[0] = shared
+#define TRU_HPS_ACP_USER_WBWA_SHARED 0x1fU  // Inner write-back write-allocate, shared.  Coherent with the L1 data caches
+#define TRU_HPS_ACP_USER_NC_SHARED   0x07U  // Inner non-cacheable, shared
+
+// Fixed virtual IDs that can be mapped to a master ID
+#define TRU_HPS_ACPIDMAP_VID_FIRST 2U
+#define TRU_HPS_ACPIDMAP_VID_LAST  6U
+
+typedef struct{
+	volatile uint32_t vid2rd;
+	volatile uint32_t vid2wr;
+	volatile uint32_t vid3rd;
+	volatile uint32_t vid3wr;
+	volatile uint32_t vid4rd;
+	volatile uint32_t vid4wr;
+	volatile uint32_t vid5rd;
+	volatile uint32_t vid5wr;
+	volatile uint32_t vid6rd;
+	volatile uint32_t vid6wr;
+	volatile uint32_t dynrd;
+	volatile uint32_t dynwr;
+	volatile uint32_t vid2rd_s;  // Status registers (read only) of the current mapping
+	volatile uint32_t vid2wr_s;
+	volatile uint32_t vid3rd_s;
+	volatile uint32_t vid3wr_s;
+	volatile uint32_t vid4rd_s;
+	volatile uint32_t vid4wr_s;
+	volatile uint32_t vid5rd_s;
+	volatile uint32_t vid5wr_s;
+	volatile uint32_t vid6rd_s;
+	volatile uint32_t vid6wr_s;
+	volatile uint32_t dynrd_s;
+	volatile uint32_t dynwr_s;
+}tru_hps_acpidmap_reg_t;
+
+#define TRU_HPS_ACPIDMAP_REG ((volatile tru_hps_acpidmap_reg_t *const)TRU_HPS_ACPIDMAP_BASE)
+
+// Place a statically allocated object in the ACP coherent buffer block.  Note, the block is not zero initialised
+#define TRU_ACP_BUFFER __attribute__((section(".acp_buffer"), aligned(TRU_HPS_ACP_ALIGN)))
+
+// Converts a CPU (SDRAM) address to the address an L3 master must use to access it through the ACP
+static inline uint32_t tru_hps_acp_bus_addr(const void *cpu_addr){
+	return TRU_HPS_ACP_WINDOW_BASE | ((uint32_t)cpu_addr & (TRU_HPS_ACP_WINDOW_SIZE - 1U));
+}
+
+// Returns the ID mapper page (1GB index) of a CPU address
+static inline uint32_t tru_hps_acp_page(const void *cpu_addr){
+	return (uint32_t)cpu_addr >> 30U;
+}
+
+void tru_hps_acp_set_dynamic(uint32_t page, uint32_t user);
+int tru_hps_acp_set_fixed(uint32_t vid, uint32_t mid, uint32_t page, uint32_t user);
+bool tru_hps_acp_is_coherent(void);
+void tru_hps_acp_init(void);
+void *tru_hps_acp_alloc(uint32_t size);
+void tru_hps_acp_free_all(void);
+uint32_t tru_hps_acp_get_free(void);
+
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_c5soc_hps_amp.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "tru_c5soc_hps_smp.h"
+#include "arm/tru_cortex_a9.h"
+#include "tru_cache.h"
+#include "tru_crt.h"
+#include <string.h>
+
+#if defined(TRU_AMP_CORE1_BIN)
+	// Embed the CPU1 image binary, the path is set by the makefile
+	__asm__(
+		".section .rodata.tru_hps_amp_core1_image, \"a\"  \n"
+		".balign 32                                       \n"
+		".global tru_hps_amp_core1_image_start            \n"
+		"tru_hps_amp_core1_image_start:                   \n"
+		".incbin \"" TRU_AMP_CORE1_BIN "\"                \n"
+		".global tru_hps_amp_core1_image_end              \n"
+		"tru_hps_amp_core1_image_end:                     \n"
+		".previous                                        \n"
+	);
+
+	extern const uint8_t tru_hps_amp_core1_image_start[];
+	extern const uint8_t tru_hps_amp_core1_image_end[];
+#endif
+
+// Clears the shared memory rings.  Called from CPU0 before CPU1 is started
+void tru_hps_amp_init(void){
+	tru_hps_amp_shm_t *shm = TRU_HPS_AMP_SHM;
+
+	memset(shm, 0, sizeof(tru_hps_amp_shm_t));
+	__DMB();
+	shm->magic = TRU_HPS_AMP_MAGIC;
+	__DSB();
+}
+
+bool tru_hps_amp_is_ready(void){
+	return TRU_HPS_AMP_SHM->magic == TRU_HPS_AMP_MAGIC;
+}
+
+/*
+	Copies the embedded CPU1 image to TRU_HPS_AMP_CORE1_BASE and starts it on
+	CPU1.  Called from CPU0.  Returns 0 on success, or -1 if this is not an
+	AMP build (make amp=1), the image is too large or CPU1 cannot be released.
+*/
+int tru_hps_amp_start_core1(void){
+#if defined(TRU_AMP_CORE1_BIN)
+	uint32_t len = (uint32_t)(tru_hps_amp_core1_image_end - tru_hps_amp_core1_image_start);
+
+	if(len > TRU_HPS_AMP_CORE1_SIZE) return -1;
+
+	tru_hps_smp_stop_core1();  // Make sure CPU1 is in reset
+	tru_crt_copy((void *)TRU_HPS_AMP_CORE1_BASE, tru_hps_amp_core1_image_start, len);
+
+	// CPU1 starts with its caches and MMU off, so write the image out to the DDR.  It is also invalidated, the region belongs to CPU1 from now on
+	if(tru_l1_is_dcache_enabled()) tru_l1_data_cleaninv_range((void *)TRU_HPS_AMP_CORE1_BASE, len);
+	if(tru_l2_is_enabled()) tru_l2_data_cleaninv_range((void *)TRU_HPS_AMP_CORE1_BASE, len);
+
+	return tru_hps_smp_release_core1(TRU_HPS_AMP_CORE1_BASE);  // The image starts with its vector table, so the entry is the reset vector
+#else
+	return -1;
+#endif
+}
+
+// Registers and enables the doorbell handler, it is called when the other CPU has sent a message
+void tru_hps_amp_set_doorbell(IRQHandler_t handler){
+	IRQ_SetHandler(TRU_HPS_AMP_SGI, handler);
+	IRQ_Enable(TRU_HPS_AMP_SGI);
+}
+
+/*
+	Sends a message to the other CPU and rings its doorbell.
+	Returns 0 on success, or -1 if the payload is too large or the ring is full.
+*/
+int tru_hps_amp_send(uint32_t type, const void *data, uint32_t len){
+	uint32_t cpu = tru_cpu_id();
+	tru_hps_amp_ring_t *ring = &TRU_HPS_AMP_SHM->ring[cpu];
+	uint32_t head = ring->head;
+	tru_hps_amp_msg_t *msg;
+
+	if(len > TRU_HPS_AMP_DATA_SIZE) return -1;
+	if(head - ring->tail >= TRU_HPS_AMP_RING_LEN) return -1;  // Full
+
+	msg = &ring->msg[head & (TRU_HPS_AMP_RING_LEN - 1U)];
+	msg->type = type;
+	msg->len = len;
+	if(len) memcpy(msg->data, data, len);
+
+	__DMB();  // Message is written before it is published
+	ring->head = head + 1U;
+	__DSB();  // Head is visible before the doorbell
+
+	GIC_SendSGI(TRU_HPS_AMP_SGI, 1U << (cpu ^ 1U), 0U);  // Filter 0 = send to the target list
+
+	return 0;
+}
+
+/*
+	Receives the next message from the other CPU.
+	Returns 0 on success, or -1 if the ring is empty.
+*/
+int tru_hps_amp_recv(tru_hps_amp_msg_t *msg){
+	tru_hps_amp_ring_t *ring = &TRU_HPS_AMP_SHM->ring[tru_cpu_id() ^ 1U];
+	uint32_t tail = ring->tail;
+
+	if(tail == ring->head) return -1;  // Empty
+
+	__DMB();  // Head is read before the message
+	*msg = ring->msg[tail & (TRU_HPS_AMP_RING_LEN - 1U)];
+	__DMB();  // Message is read before the slot is released
+	ring->tail = tail + 1U;
+
+	return 0;
+}
+
+// Returns true if there is no message from the other CPU
+bool tru_hps_amp_rx_empty(void){
+	tru_hps_amp_ring_t *ring = &TRU_HPS_AMP_SHM->ring[tru_cpu_id() ^ 1U];
+
+	return ring->tail == ring->head;
+}
+
+#endif
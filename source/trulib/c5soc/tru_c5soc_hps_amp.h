@@ -0,0 +1,110 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	AMP (Asymmetric Multiprocessing) support for Cyclone V SoC HPS.
+
+	With make amp=1 two separate images are built from this tree:
+		- The CPU0 image, from the top level sources, linked below
+		  TRU_HPS_AMP_SHM_BASE
+		- The CPU1 image, from the core1 folder, with its own linker script
+		  (bsp/tru_c5soc_ddr_core1.ld) at TRU_HPS_AMP_CORE1_BASE.  It is built
+		  with TRU_AMP_CORE1 == 1U, so it leaves the shared SCU, L2 cache,
+		  GIC distributor, OCRAM and UART to CPU0
+
+	The CPU1 binary is embedded into the CPU0 image.  tru_hps_amp_start_core1()
+	copies it to TRU_HPS_AMP_CORE1_BASE and starts it on CPU1 (see
+	tru_c5soc_hps_smp.h).  The two images have their own heap, newlib and
+	stdio, so there is no lock contention between them.
+
+	The images talk through two single producer, single consumer rings in the
+	shared memory block at TRU_HPS_AMP_SHM_BASE, one for each direction.  A
+	send rings the doorbell of the other CPU with a SGI.  Both CPUs map the
+	DDR as shareable write-back and have joined SMP coherency through the SCU,
+	so the rings need barriers but no cache maintenance.
+
+	Requirements:
+		- TRU_SCU == 1U and TRU_SMP_COHERENCY == 1U in the CPU0 image and
+		  TRU_SMP_COHERENCY == 1U in the CPU1 image
+		- The addresses below match the linker scripts
+*/
+
+#ifndef TRU_C5SOC_HPS_AMP_H
+#define TRU_C5SOC_HPS_AMP_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+#include <stdbool.h>
+
+// DDR layout, must match __AMP_RESERVED_SIZE in bsp/tru_c5soc_ddr.ld and __RAM_BASE in bsp/tru_c5soc_ddr_core1.ld
+#define TRU_HPS_AMP_CORE1_BASE 0x30000000UL  // CPU1 image
+#define TRU_HPS_AMP_CORE1_SIZE 0x10000000UL  // 256MB
+#define TRU_HPS_AMP_SHM_SIZE   0x00100000UL  // 1MB
+#define TRU_HPS_AMP_SHM_BASE   (TRU_HPS_AMP_CORE1_BASE - TRU_HPS_AMP_SHM_SIZE)
+
+#define TRU_HPS_AMP_SGI       SGI8_IRQn  // Doorbell
+#define TRU_HPS_AMP_MAGIC     0x414d5031UL  // "AMP1", set by CPU0 when the shared memory is initialised
+#define TRU_HPS_AMP_RING_LEN  64U  // Messages per ring, must be a power of 2
+#define TRU_HPS_AMP_DATA_SIZE 56U  // Maximum message payload
+
+// A message is 64 bytes, two cache lines
+typedef struct{
+	uint32_t type;
+	uint32_t len;
+	uint8_t data[TRU_HPS_AMP_DATA_SIZE];
+}tru_hps_amp_msg_t;
+
+// The head and tail are in their own cache line, so the sender and receiver do not write to the same line
+typedef struct{
+	volatile uint32_t head;  // Written by the sender only
+	uint32_t res1[7];
+	volatile uint32_t tail;  // Written by the receiver only
+	uint32_t res2[7];
+	tru_hps_amp_msg_t msg[TRU_HPS_AMP_RING_LEN];
+}tru_hps_amp_ring_t;
+
+typedef struct{
+	volatile uint32_t magic;
+	uint32_t res[7];
+	tru_hps_amp_ring_t ring[2];  // ring[n] is sent by CPUn
+}tru_hps_amp_shm_t;
+
+#define TRU_HPS_AMP_SHM ((tru_hps_amp_shm_t *)TRU_HPS_AMP_SHM_BASE)
+
+void tru_hps_amp_init(void);
+bool tru_hps_amp_is_ready(void);
+int tru_hps_amp_start_core1(void);
+void tru_hps_amp_set_doorbell(IRQHandler_t handler);
+int tru_hps_amp_send(uint32_t type, const void *data, uint32_t len);
+int tru_hps_amp_recv(tru_hps_amp_msg_t *msg);
+bool tru_hps_amp_rx_empty(void);
+
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cyclone V SoC HPS clock manager.
+*/
+
+#include "tru_c5soc_hps_clkmgr.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_time.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+// Output of a counter, divider is the register value + 1
+static inline uint32_t tru_hps_clkmgr_cnt(uint32_t hz, uint32_t reg){
+	return hz / ((reg & TRU_HPS_CLKMGR_CNT_MSK) + 1U);
+}
+
+// Decodes a PLL VCO register, a bypassed PLL passes its reference clock through
+static uint32_t tru_hps_clkmgr_vco(uint32_t vco, uint32_t ref, bool bypass){
+	uint32_t numer = (vco & TRU_HPS_CLKMGR_VCO_NUMER_MSK) >> TRU_HPS_CLKMGR_VCO_NUMER_POS;
+	uint32_t denom = (vco & TRU_HPS_CLKMGR_VCO_DENOM_MSK) >> TRU_HPS_CLKMGR_VCO_DENOM_POS;
+
+	if(bypass) return ref;
+	return (uint32_t)((uint64_t)ref * (numer + 1U) / (denom + 1U));
+}
+
+// Reference of the peripheral or SDRAM PLL from its PSRC or SSRC field
+static uint32_t tru_hps_clkmgr_ref(uint32_t vco, uint32_t f2s_ref){
+	switch((vco & TRU_HPS_CLKMGR_VCO_SRC_MSK) >> TRU_HPS_CLKMGR_VCO_SRC_POS){
+		case 0U: return TRU_HPS_INPUT_CLK_HZ;
+		case 1U: return TRU_HPS_OSC2_CLK_HZ;
+		case 2U: return f2s_ref;
+		default: return 0U;
+	}
+}
+
+static uint32_t tru_hps_clkmgr_main_vco(void){
+	volatile tru_hps_clkmgr_reg_t *cm = TRU_HPS_CLKMGR_REG;
+
+	return tru_hps_clkmgr_vco(cm->main_vco, TRU_HPS_INPUT_CLK_HZ, cm->bypass & TRU_HPS_CLKMGR_BYPASS_MAINPLL_MSK);  // The main PLL always runs from OSC1
+}
+
+uint32_t tru_hps_clkmgr_get_mpu_hz(void){
+	volatile tru_hps_clkmgr_reg_t *cm = TRU_HPS_CLKMGR_REG;
+
+	return tru_hps_clkmgr_cnt(tru_hps_clkmgr_cnt(tru_hps_clkmgr_main_vco(), cm->altera_mpuclk), cm->main_mpuclk);
+}
+
+void tru_hps_clkmgr_get_clocks(tru_hps_clocks_t *clocks){
+	volatile tru_hps_clkmgr_reg_t *cm = TRU_HPS_CLKMGR_REG;
+	uint32_t maindiv = cm->main_maindiv;
+	uint32_t l4src = cm->main_l4src;
+	uint32_t per_vco = cm->per_vco;
+	uint32_t sdr_vco = cm->sdr_vco;
+
+	clocks->main_vco = tru_hps_clkmgr_main_vco();
+	clocks->per_vco = tru_hps_clkmgr_vco(per_vco, tru_hps_clkmgr_ref(per_vco, TRU_HPS_F2S_PER_REF_HZ), cm->bypass & TRU_HPS_CLKMGR_BYPASS_PERPLL_MSK);
+	clocks->sdr_vco = tru_hps_clkmgr_vco(sdr_vco, tru_hps_clkmgr_ref(sdr_vco, TRU_HPS_F2S_SDR_REF_HZ), cm->bypass & TRU_HPS_CLKMGR_BYPASS_SDRPLL_MSK);
+
+	clocks->mpu = tru_hps_clkmgr_cnt(tru_hps_clkmgr_cnt(clocks->main_vco, cm->altera_mpuclk), cm->main_mpuclk);
+	clocks->mpu_periph = clocks->mpu / 4U;
+	clocks->main = tru_hps_clkmgr_cnt(tru_hps_clkmgr_cnt(clocks->main_vco, cm->altera_mainclk), cm->main_mainclk);
+	clocks->l3_mp = clocks->main >> ((maindiv & TRU_HPS_CLKMGR_MAINDIV_L3MP_MSK) >> TRU_HPS_CLKMGR_MAINDIV_L3MP_POS);
+	clocks->l3_sp = clocks->l3_mp >> ((maindiv & TRU_HPS_CLKMGR_MAINDIV_L3SP_MSK) >> TRU_HPS_CLKMGR_MAINDIV_L3SP_POS);
+	clocks->periph_base = tru_hps_clkmgr_cnt(clocks->per_vco, cm->per_perbaseclk);
+	clocks->l4_mp = ((l4src & TRU_HPS_CLKMGR_L4SRC_L4MP_MSK) ? clocks->periph_base : clocks->main) >> ((maindiv & TRU_HPS_CLKMGR_MAINDIV_L4MP_MSK) >> TRU_HPS_CLKMGR_MAINDIV_L4MP_POS);
+	clocks->l4_sp = ((l4src & TRU_HPS_CLKMGR_L4SRC_L4SP_MSK) ? clocks->periph_base : clocks->main) >> ((maindiv & TRU_HPS_CLKMGR_MAINDIV_L4SP_MSK) >> TRU_HPS_CLKMGR_MAINDIV_L4SP_POS);
+	clocks->ddr_dqs = tru_hps_clkmgr_cnt(clocks->sdr_vco, cm->sdr_ddrdqsclk);
+}
+
+uint32_t tru_hps_clkmgr_get_l4_sp_hz(void){
+	tru_hps_clocks_t clocks;
+
+	tru_hps_clkmgr_get_clocks(&clocks);
+	return clocks.l4_sp;
+}
+
+/*
+	Sets the MPU clock to the highest frequency the MPU counter can divide
+	down to that is not above hz or TRU_HPS_MPU_MAX_HZ.  Updates
+	SystemCoreClock and tru_time.
+	Returns the new MPU clock in Hz.
+*/
+uint32_t tru_hps_clkmgr_set_mpu_hz(uint32_t hz){
+	volatile tru_hps_clkmgr_reg_t *cm = TRU_HPS_CLKMGR_REG;
+	uint32_t src = tru_hps_clkmgr_cnt(tru_hps_clkmgr_main_vco(), cm->altera_mpuclk);
+	uint32_t div;
+
+	if(hz > TRU_HPS_MPU_MAX_HZ) hz = TRU_HPS_MPU_MAX_HZ;
+	if(hz == 0U || src == 0U) return tru_hps_clkmgr_get_mpu_hz();
+
+	div = (src + hz - 1U) / hz;  // Round up, never above hz
+	if(div == 0U) div = 1U;
+	if(div > TRU_HPS_CLKMGR_CNT_MSK + 1U) div = TRU_HPS_CLKMGR_CNT_MSK + 1U;
+
+	// The counter switches glitch free, wait for the clock manager to finish
+	cm->main_mpuclk = (cm->main_mpuclk & ~TRU_HPS_CLKMGR_CNT_MSK) | (div - 1U);
+	while(cm->stat & TRU_HPS_CLKMGR_STAT_BUSY_MSK);
+
+	SystemCoreClockUpdate();
+	tru_time_init();
+
+	return SystemCoreClock;
+}
+
+void tru_hps_clkmgr_print(void){
+	tru_hps_clocks_t c;
+
+	tru_hps_clkmgr_get_clocks(&c);
+	printf("Clocks (Hz)\n");
+	printf("main vco    %10lu\n", (unsigned long)c.main_vco);
+	printf("per vco     %10lu\n", (unsigned long)c.per_vco);
+	printf("sdr vco     %10lu\n", (unsigned long)c.sdr_vco);
+	printf("mpu         %10lu\n", (unsigned long)c.mpu);
+	printf("mpu periph  %10lu\n", (unsigned long)c.mpu_periph);
+	printf("main (l3)   %10lu\n", (unsigned long)c.main);
+	printf("l3 mp       %10lu\n", (unsigned long)c.l3_mp);
+	printf("l3 sp       %10lu\n", (unsigned long)c.l3_sp);
+	printf("l4 mp       %10lu\n", (unsigned long)c.l4_mp);
+	printf("l4 sp       %10lu\n", (unsigned long)c.l4_sp);
+	printf("periph base %10lu\n", (unsigned long)c.periph_base);
+	printf("ddr dqs     %10lu\n", (unsigned long)c.ddr_dqs);
+}
+
+#endif
@@ -0,0 +1,189 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cyclone V SoC HPS clock manager: reads the clock tree from the PLL and
+	divider registers, and changes the MPU clock.
+
+	The frequencies are computed from what the registers hold at run time,
+	as set up by the preloader (bsp/pll_config.h), not from build time
+	constants:
+		VCO             = ref * (numer + 1) / (denom + 1)
+		mpu_clk         = main VCO / (altera mpuclk + 1) / (mpuclk + 1)
+		main_clk        = main VCO / (altera mainclk + 1) / (mainclk + 1), also l3_main_clk
+		l3_mp_clk       = main_clk / 2^l3mpclk
+		l3_sp_clk       = l3_mp_clk / 2^l3spclk
+		periph_base_clk = peripheral VCO / (perbaseclk + 1)
+		l4_mp_clk       = main_clk or periph_base_clk / 2^l4mpclk
+		l4_sp_clk       = main_clk or periph_base_clk / 2^l4spclk, the UART, SPI, SP timer clock
+		ddr_dqs_clk     = SDRAM VCO / (ddrdqsclk + 1)
+		mpu_periph_clk  = mpu_clk / 4, the Cortex-A9 global and private timers
+	The PLL references are OSC1 (TRU_HPS_INPUT_CLK_HZ from the board header),
+	OSC2 (TRU_HPS_OSC2_CLK_HZ) or a clock from the FPGA (TRU_HPS_F2S_PER_REF_HZ
+	and TRU_HPS_F2S_SDR_REF_HZ), the board header may define these.
+
+	Changing the MPU clock:
+		tru_hps_clkmgr_set_mpu_hz() only changes the MPU counter (C0) of the
+		main PLL, so the main PLL keeps running and the L3, L4 and peripheral
+		clocks do not change.  The result is clamped to TRU_HPS_MPU_MAX_HZ, the
+		rating of the device speed grade.  It then updates SystemCoreClock and
+		recalibrates tru_time.
+
+	Notes:
+		- The Cortex-A9 timers run from mpu_periph_clk, changing the MPU clock
+		  changes their rate.  Timers already counting (tru_timer, tru_co,
+		  tru_thread sleeps, the FreeRTOS tick) keep their tick counts
+		- Call it from one CPU while the other is idle
+*/
+
+#ifndef TRU_C5SOC_HPS_CLKMGR_H
+#define TRU_C5SOC_HPS_CLKMGR_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include <stdint.h>
+
+#define TRU_HPS_CLKMGR_BASE 0xffd04000UL
+
+// The maximum MPU clock of the device speed grade: 925 MHz for -C6, 800 MHz for -C7, -I7 (DE10-Nano), 600 MHz for -C8
+#ifndef TRU_HPS_MPU_MAX_HZ
+	#define TRU_HPS_MPU_MAX_HZ 800000000UL
+#endif
+
+// Other PLL references, 0 = not connected
+#ifndef TRU_HPS_OSC2_CLK_HZ
+	#define TRU_HPS_OSC2_CLK_HZ 0UL
+#endif
+#ifndef TRU_HPS_F2S_PER_REF_HZ
+	#define TRU_HPS_F2S_PER_REF_HZ 0UL
+#endif
+#ifndef TRU_HPS_F2S_SDR_REF_HZ
+	#define TRU_HPS_F2S_SDR_REF_HZ 0UL
+#endif
+
+// Register bits
+#define TRU_HPS_CLKMGR_BYPASS_MAINPLL_MSK 0x00000001UL
+#define TRU_HPS_CLKMGR_BYPASS_SDRPLL_MSK  0x00000002UL
+#define TRU_HPS_CLKMGR_BYPASS_PERPLL_MSK  0x00000008UL
+#define TRU_HPS_CLKMGR_STAT_BUSY_MSK      0x00000001UL
+#define TRU_HPS_CLKMGR_VCO_NUMER_POS      3U
+#define TRU_HPS_CLKMGR_VCO_NUMER_MSK      0x0000fff8UL
+#define TRU_HPS_CLKMGR_VCO_DENOM_POS      16U
+#define TRU_HPS_CLKMGR_VCO_DENOM_MSK      0x003f0000UL
+#define TRU_HPS_CLKMGR_VCO_SRC_POS        22U   // PSRC, SSRC: 0 = OSC1, 1 = OSC2, 2 = FPGA reference
+#define TRU_HPS_CLKMGR_VCO_SRC_MSK        0x00c00000UL
+#define TRU_HPS_CLKMGR_CNT_MSK            0x000001ffUL
+#define TRU_HPS_CLKMGR_MAINDIV_L3MP_POS   0U
+#define TRU_HPS_CLKMGR_MAINDIV_L3MP_MSK   0x00000003UL
+#define TRU_HPS_CLKMGR_MAINDIV_L3SP_POS   2U
+#define TRU_HPS_CLKMGR_MAINDIV_L3SP_MSK   0x0000000cUL
+#define TRU_HPS_CLKMGR_MAINDIV_L4MP_POS   4U
+#define TRU_HPS_CLKMGR_MAINDIV_L4MP_MSK   0x00000070UL
+#define TRU_HPS_CLKMGR_MAINDIV_L4SP_POS   7U
+#define TRU_HPS_CLKMGR_MAINDIV_L4SP_MSK   0x00000380UL
+#define TRU_HPS_CLKMGR_L4SRC_L4MP_MSK     0x00000001UL  // 0 = main_clk, 1 = periph_base_clk
+#define TRU_HPS_CLKMGR_L4SRC_L4SP_MSK     0x00000002UL
+
+typedef struct{
+	volatile uint32_t ctrl;
+	volatile uint32_t bypass;
+	volatile uint32_t inter;
+	volatile uint32_t intren;
+	volatile uint32_t dbctrl;
+	volatile uint32_t stat;
+	volatile uint32_t reserved[10];
+	// Main PLL group, 0x40
+	volatile uint32_t main_vco;
+	volatile uint32_t main_misc;
+	volatile uint32_t main_mpuclk;
+	volatile uint32_t main_mainclk;
+	volatile uint32_t main_dbgatclk;
+	volatile uint32_t main_mainqspiclk;
+	volatile uint32_t main_mainnandsdmmcclk;
+	volatile uint32_t main_cfgs2fuser0clk;
+	volatile uint32_t main_en;
+	volatile uint32_t main_maindiv;
+	volatile uint32_t main_dbgdiv;
+	volatile uint32_t main_tracediv;
+	volatile uint32_t main_l4src;
+	volatile uint32_t main_stat;
+	volatile uint32_t reserved2[2];
+	// Peripheral PLL group, 0x80
+	volatile uint32_t per_vco;
+	volatile uint32_t per_misc;
+	volatile uint32_t per_emac0clk;
+	volatile uint32_t per_emac1clk;
+	volatile uint32_t per_perqspiclk;
+	volatile uint32_t per_pernandsdmmcclk;
+	volatile uint32_t per_perbaseclk;
+	volatile uint32_t per_s2fuser1clk;
+	volatile uint32_t per_en;
+	volatile uint32_t per_div;
+	volatile uint32_t per_gpiodiv;
+	volatile uint32_t per_src;
+	volatile uint32_t per_stat;
+	volatile uint32_t reserved3[3];
+	// SDRAM PLL group, 0xc0
+	volatile uint32_t sdr_vco;
+	volatile uint32_t sdr_ctrl;
+	volatile uint32_t sdr_ddrdqsclk;
+	volatile uint32_t sdr_ddr2xdqsclk;
+	volatile uint32_t sdr_ddrdqclk;
+	volatile uint32_t sdr_s2fuser2clk;
+	volatile uint32_t sdr_en;
+	volatile uint32_t sdr_stat;
+	// Altera group, 0xe0
+	volatile uint32_t altera_mpuclk;
+	volatile uint32_t altera_mainclk;
+}tru_hps_clkmgr_reg_t;
+
+#define TRU_HPS_CLKMGR_REG ((volatile tru_hps_clkmgr_reg_t *const)TRU_HPS_CLKMGR_BASE)
+
+// Frequencies in Hz, 0 = unknown reference
+typedef struct{
+	uint32_t main_vco;
+	uint32_t per_vco;
+	uint32_t sdr_vco;
+	uint32_t mpu;
+	uint32_t mpu_periph;
+	uint32_t main;
+	uint32_t l3_mp;
+	uint32_t l3_sp;
+	uint32_t l4_mp;
+	uint32_t l4_sp;
+	uint32_t periph_base;
+	uint32_t ddr_dqs;
+}tru_hps_clocks_t;
+
+void tru_hps_clkmgr_get_clocks(tru_hps_clocks_t *clocks);
+uint32_t tru_hps_clkmgr_get_mpu_hz(void);
+uint32_t tru_hps_clkmgr_get_l4_sp_hz(void);
+uint32_t tru_hps_clkmgr_set_mpu_hz(uint32_t hz);
+void tru_hps_clkmgr_print(void);
+
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_c5soc_hps_ocram.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC) && defined(TRU_OCRAM) && TRU_OCRAM == 1U
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_cache.h"
+#include "tru_boot_ts.h"
+#include <stdint.h>
+
+extern uint32_t __ocram_text_start;  // Reference external symbol name from the linker file
+extern uint32_t __ocram_text_end;    // Reference external symbol name from the linker file
+extern uint32_t __ocram_text_load;   // Reference external symbol name from the linker file
+extern uint32_t __ocram_data_start;  // Reference external symbol name from the linker file
+extern uint32_t __ocram_data_end;    // Reference external symbol name from the linker file
+extern uint32_t __ocram_data_load;   // Reference external symbol name from the linker file
+extern uint32_t __ocram_bss_start;   // Reference external symbol name from the linker file
+extern uint32_t __ocram_bss_end;     // Reference external symbol name from the linker file
+
+/*
+	Copies the OCRAM text and data from their load addresses in DDR, and clears
+	the OCRAM bss.  This is called by Reset_Handler before SystemInit(), so it
+	must not use global variables.
+*/
+void tru_hps_ocram_init(void){
+	volatile uint32_t *src;
+	volatile uint32_t *dst;
+
+	// Copy text
+	src = &__ocram_text_load;
+	for(dst = &__ocram_text_start; dst < &__ocram_text_end; dst++) *dst = *src++;
+
+	// Copy data
+	src = &__ocram_data_load;
+	for(dst = &__ocram_data_start; dst < &__ocram_data_end; dst++) *dst = *src++;
+
+	// Clear bss
+	for(dst = &__ocram_bss_start; dst < &__ocram_bss_end; dst++) *dst = 0U;
+
+	// Make the copied code visible to instruction fetch, the data cache may still be on when started from U-Boot
+	if(&__ocram_text_end != &__ocram_text_start){
+		if(tru_l1_is_dcache_enabled()){
+			tru_l1_data_clean_range(&__ocram_text_start, (uint32_t)&__ocram_text_end - (uint32_t)&__ocram_text_start);
+		}
+		__set_ICIALLU(0);
+		__set_BPIALL(0);
+		__DSB();
+		__ISB();
+	}
+
+	tru_boot_ts_mark(TRU_BOOT_TS_OCRAM);
+}
+
+#endif
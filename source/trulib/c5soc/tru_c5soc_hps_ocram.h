@@ -0,0 +1,68 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Hot code and data placement in the 64kB HPS On-Chip RAM (OCRAM).
+
+	Functions and variables tagged with TRU_OCRAM_TEXT, TRU_OCRAM_DATA and
+	TRU_OCRAM_BSS are linked to run from the OCRAM, but are loaded with the
+	image into DDR.  The startup copies them down (and clears the bss part)
+	before SystemInit() is called.  On a cache miss the OCRAM has a much
+	lower latency than the DDR-3 SDRAM.
+
+	Notes:
+		- The OCRAM is mapped as normal executable memory by mmu_c5soc.c, with
+		  TRU_MMU == 2U (MMU left as set by U-Boot) it may not be executable
+		- Calls between OCRAM and DDR code are long calls, the linker adds
+		  veneers where needed
+		- The linker script checks the total size fits in the 64kB
+		- Off by default, enable with TRU_CFG_OCRAM.  When off the tags are
+		  empty
+*/
+
+#ifndef TRU_C5SOC_HPS_OCRAM_H
+#define TRU_C5SOC_HPS_OCRAM_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#define TRU_HPS_OCRAM_SIZE 0x10000UL  // 64kB
+
+#if defined(TRU_OCRAM) && TRU_OCRAM == 1U
+	#define TRU_OCRAM_TEXT __attribute__((section(".ocram_text"), noinline, long_call))
+	#define TRU_OCRAM_DATA __attribute__((section(".ocram_data")))
+	#define TRU_OCRAM_BSS  __attribute__((section(".ocram_bss")))
+#else
+	// Not copied down by the startup, so the tagged code and data stay in DDR
+	#define TRU_OCRAM_TEXT
+	#define TRU_OCRAM_DATA
+	#define TRU_OCRAM_BSS
+#endif
+
+void tru_hps_ocram_init(void);
+
+#endif
+
+#endif
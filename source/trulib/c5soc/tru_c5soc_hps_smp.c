@@ -0,0 +1,161 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_c5soc_hps_smp.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_cache.h"
+#include <stddef.h>
+
+extern uint32_t Image$$VECTORS$$Base;  // Reference external symbol name from the linker file
+extern void Reset_Handler_core1(void);
+
+tru_hps_smp_boot_t tru_hps_smp_boot;
+
+// Function posted to the default main_core1()
+static void (*volatile tru_hps_smp_call_fn)(void *);
+static void *volatile tru_hps_smp_call_arg;
+
+// Trampoline for CPU1, it jumps to the address in the cpu1startaddr register
+static const uint32_t tru_hps_smp_trampoline[] = {
+	0xe59f0000U,                  // LDR r0, [pc, #0]
+	0xe590f000U,                  // LDR pc, [r0]
+	TRU_HPS_SYSMGR_CPU1STARTADDR  // cpu1startaddr register address
+};
+
+// Cleans a range from the data caches to the DDR, so that it is seen by CPU1 before its caches are enabled
+static void tru_hps_smp_clean(void *buf, uint32_t len){
+	if(tru_l1_is_dcache_enabled()) tru_l1_data_clean_range(buf, len);
+	if(tru_l2_is_enabled()) tru_l2_data_clean_range(buf, len);
+}
+
+/*
+	Releases CPU1 from reset to run from the entry address.  CPU1 must already
+	be in reset (see tru_hps_smp_stop_core1()).  Called from CPU0.
+	Returns 0 on success, or -1 if the trampoline cannot be written.
+*/
+int tru_hps_smp_release_core1(uint32_t entry){
+	volatile uint32_t *tramp = (volatile uint32_t *)TRU_HPS_SMP_TRAMPOLINE_ADDR;
+
+	// The trampoline would overwrite the vector table of this image
+	if((uint32_t)&Image$$VECTORS$$Base == TRU_HPS_SMP_TRAMPOLINE_ADDR) return -1;
+
+	// Hide the constant address from the compiler, a store to address 0 would otherwise be treated as a NULL dereference
+	__ASM volatile("" : "+r" (tramp));
+	for(uint32_t i = 0U; i < sizeof(tru_hps_smp_trampoline) / sizeof(tru_hps_smp_trampoline[0]); i++){
+		tramp[i] = tru_hps_smp_trampoline[i];
+	}
+	tru_hps_smp_clean((void *)tramp, sizeof(tru_hps_smp_trampoline));
+
+	*(volatile uint32_t *)TRU_HPS_SYSMGR_CPU1STARTADDR = entry;
+	__DSB();
+
+	// Release CPU1 from reset
+	*(volatile uint32_t *)TRU_HPS_RSTMGR_MPUMODRST &= ~TRU_HPS_RSTMGR_MPUMODRST_CPU1;
+	__DSB();
+
+	return 0;
+}
+
+/*
+	Releases CPU1 from reset to run main_core1().  Called from CPU0.
+	Returns 0 when CPU1 has reported in, or -1 on error or timeout.
+*/
+int tru_hps_smp_start_core1(void){
+	tru_hps_smp_stop_core1();  // Make sure CPU1 is in reset
+
+	// Settings for CPU1
+	tru_hps_smp_boot.sctlr = __get_SCTLR();
+	tru_hps_smp_boot.ttbr0 = __get_TTBR0();
+	__get_CP(15, 0, tru_hps_smp_boot.ttbcr, 2, 0, 2);  // TTBCR
+	tru_hps_smp_boot.dacr = __get_DACR();
+	tru_hps_smp_boot.started = 0U;
+	tru_hps_smp_call_fn = NULL;
+	tru_hps_smp_clean(&tru_hps_smp_boot, sizeof(tru_hps_smp_boot));
+
+	if(tru_hps_smp_release_core1((uint32_t)Reset_Handler_core1)) return -1;
+
+	for(uint32_t i = 0U; i < TRU_HPS_SMP_START_TIMEOUT; i++){
+		if(tru_hps_smp_boot.started) return 0;
+	}
+
+	return -1;
+}
+
+/*
+	Puts CPU1 back into reset, e.g. before returning to U-Boot.  Data still in
+	the CPU1 L1 data cache is lost.
+*/
+void tru_hps_smp_stop_core1(void){
+	*(volatile uint32_t *)TRU_HPS_RSTMGR_MPUMODRST |= TRU_HPS_RSTMGR_MPUMODRST_CPU1;
+	__DSB();
+}
+
+/*
+	Posts a function for the default main_core1() to run on CPU1.  Called from
+	CPU0.  Returns 0 on success, or -1 if CPU1 is not started or still busy
+	with the previous function.
+*/
+int tru_hps_smp_call_core1(void (*fn)(void *), void *arg){
+	if(!tru_hps_smp_boot.started || tru_hps_smp_call_fn != NULL) return -1;
+
+	tru_hps_smp_call_arg = arg;
+	__DMB();  // The argument is visible before the function
+	tru_hps_smp_call_fn = fn;
+	__DSB();  // The function is visible before the event
+	__SEV();
+
+	return 0;
+}
+
+// Returns true while CPU1 is running a function posted by tru_hps_smp_call_core1()
+bool tru_hps_smp_core1_busy(void){
+	return tru_hps_smp_call_fn != NULL;
+}
+
+// Default CPU1 entry point, runs the functions posted by tru_hps_smp_call_core1().  Override this with your own
+__attribute__((weak)) void main_core1(void){
+	while(1){
+		void (*fn)(void *) = tru_hps_smp_call_fn;
+
+		if(fn == NULL){
+			__WFE();  // An SEV after the read above makes this fall through
+			continue;
+		}
+		__DMB();  // Read the argument after the function
+		fn(tru_hps_smp_call_arg);
+
+		__DMB();  // The results are visible before the completion
+		tru_hps_smp_call_fn = NULL;
+		__DSB();
+		__SEV();
+	}
+}
+
+#endif
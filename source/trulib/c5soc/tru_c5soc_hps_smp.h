@@ -0,0 +1,105 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Dual-core (SMP) bring-up for Cyclone V SoC HPS.
+
+	After reset only CPU0 runs this application.  CPU1 is held in reset by the
+	reset manager.  tru_hps_smp_start_core1(), called from CPU0, writes a small
+	trampoline at address 0 (where CPU1 starts after reset) that jumps to the
+	address in the system manager cpu1startaddr register, sets that register to
+	Reset_Handler_core1 and releases CPU1 from reset.
+
+	CPU1 then runs Reset_Handler_core1 (startup_c5soc.c), which sets up its own
+	mode stacks (the *_STACK1 blocks in the linker script) and VBAR, and calls
+	SystemInit_core1() (system_c5soc.c).  That invalidates its L1 caches, TLB
+	and branch predictor, joins SMP coherency through ACTLR, enables the MMU and
+	the L1 caches with the same settings as CPU0, and enables its GIC CPU
+	interface.  Finally it unmasks interrupts and calls main_core1().
+
+	The default main_core1() waits with WFE for a function posted by CPU0 with
+	tru_hps_smp_call_core1(), runs it and waits again.  The caller can poll
+	tru_hps_smp_core1_busy() for completion.  An application that overrides
+	main_core1() cannot use these calls.
+
+	Notes:
+		- Both CPUs share the IRQ handler table, but the SGIs, PPIs and the
+		  private timer are banked per CPU.  SPIs are routed to CPU0 by default
+		- Newlib is not thread safe, e.g. do not call printf() from both CPUs
+		- The image must not be linked at address 0, which is used by the
+		  trampoline
+		- TLB lockdown (tru_cortex_a9_tlb.h) is only done on CPU0
+
+	References:
+		- Cyclone V Hard Processor System Technical Reference Manual
+		  Notable sections:
+		- Reset Manager, MPU Module Reset Register (mpumodrst)
+		- System Manager, ROM Code Group, CPU1 Start Address Register
+		  (cpu1startaddr)
+		- Cortex-A9 MPCore Technical Reference Manual
+		  Notable sections:
+		- Auxiliary Control Register (SMP and FW bits)
+*/
+
+#ifndef TRU_C5SOC_HPS_SMP_H
+#define TRU_C5SOC_HPS_SMP_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_HPS_RSTMGR_BASE           0xffd05000UL
+#define TRU_HPS_RSTMGR_MPUMODRST      (TRU_HPS_RSTMGR_BASE + 0x10U)
+#define TRU_HPS_RSTMGR_MPUMODRST_CPU1 (0x1UL << 1U)  // CPU1 held in reset when set
+
+#define TRU_HPS_SYSMGR_BASE           0xffd08000UL
+#define TRU_HPS_SYSMGR_CPU1STARTADDR  (TRU_HPS_SYSMGR_BASE + 0xc4U)
+
+#define TRU_HPS_SMP_TRAMPOLINE_ADDR   0x0UL      // CPU1 starts executing here after it is released from reset
+#define TRU_HPS_SMP_START_TIMEOUT     1000000UL  // Polling loops to wait for CPU1 to report in
+
+// CPU0 settings copied to CPU1, and the CPU1 started flag
+typedef struct{
+	uint32_t sctlr;
+	uint32_t ttbr0;
+	uint32_t ttbcr;
+	uint32_t dacr;
+	volatile uint32_t started;
+}tru_hps_smp_boot_t;
+
+extern tru_hps_smp_boot_t tru_hps_smp_boot;
+
+int tru_hps_smp_release_core1(uint32_t entry);
+int tru_hps_smp_start_core1(void);
+void tru_hps_smp_stop_core1(void);
+int tru_hps_smp_call_core1(void (*fn)(void *), void *arg);
+bool tru_hps_smp_core1_busy(void);
+void main_core1(void);
+
+#endif
+
+#endif
@@ -37,6 +37,26 @@ void tru_hps_uart_ll_wait_empty(void *uart_base){
 	while((TRU_HPS_UART_REG(uart_base)->lsr & TRU_HPS_UART_LSR_TEMT_SET_MSK) == 0U);  // Flush UART and wait
 }
 
+/*
+	Sets the baud rate divisor from the UART clock, which is l4_sp_clk (see
+	tru_hps_clkmgr_get_l4_sp_hz()).  Rounds to the nearest divisor and waits
+	for pending data to go out first.  An unknown clock (0) or a divisor out
+	of range keeps the divisor already set, e.g. by the preloader.
+*/
+void tru_hps_uart_ll_set_baud(void *uart_base, uint32_t clk_hz, uint32_t baud){
+	if(clk_hz == 0U || baud == 0U) return;
+
+	uint32_t div = (clk_hz + 8U * baud) / (16U * baud);
+
+	if(div == 0U || div > 0xffffU) return;
+
+	tru_hps_uart_ll_wait_empty(uart_base);
+	TRU_HPS_UART_REG(uart_base)->lcr |= TRU_HPS_UART_LCR_DLAB_SET_MSK;  // Access the divisor latch
+	TRU_HPS_UART_REG(uart_base)->rbr_thr_dll = div & 0xffU;
+	TRU_HPS_UART_REG(uart_base)->ier_dlh = (div >> 8U) & 0xffU;
+	TRU_HPS_UART_REG(uart_base)->lcr &= ~TRU_HPS_UART_LCR_DLAB_SET_MSK;
+}
+
 void tru_hps_uart_ll_wait_ready(void *uart_base, char fifo_th_en){
 	// Wait until the UART controller is ready to accept a byte in its transmit buffer, i.e. there is free space?
 	// They are masochists - using the same bit but with the opposite logic depending on the mode set!
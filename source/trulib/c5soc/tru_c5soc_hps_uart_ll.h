@@ -47,6 +47,7 @@
 #define TRU_HPS_UART_STET_OFFSET        0xa0U
 #define TRU_HPS_UART_LSR_TEMT_SET_MSK   0x00000040UL
 #define TRU_HPS_UART_LSR_THRE_SET_MSK   0x00000020UL
+#define TRU_HPS_UART_LCR_DLAB_SET_MSK   0x00000080UL
 
 // HPS UART0 registers
 #define TRU_HPS_UART0_BASE              0xffc02000UL
@@ -102,6 +103,7 @@ typedef struct{
 #define TRU_HPS_UART_REG(base_addr) ((volatile tru_hps_uart_reg_t *const)base_addr)
 
 void tru_hps_uart_ll_wait_empty(void *uart_base);
+void tru_hps_uart_ll_set_baud(void *uart_base, uint32_t clk_hz, uint32_t baud);
 void tru_hps_uart_ll_write_str(void *uart_base, const char *str, uint32_t len);
 void tru_hps_uart_ll_write_char(void *uart_base, const char c);
 void tru_hps_uart_ll_write_hex_nibble(void *uart_base, unsigned char nibble);
@@ -0,0 +1,111 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_boot_ts.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdio.h>
+
+#if defined(TRU_BOOT_TS) && TRU_BOOT_TS == 1U
+
+static const char *const tru_boot_ts_names[TRU_BOOT_TS_COUNT] = {
+	"Reset_Handler",
+	"OCRAM copy down",
+	"SystemInit",
+	"Invalidate TLB/BP/caches",
+	"MMU table + enable",
+	"L1 cache enable",
+	"L2 cache enable",
+	"TLB lock",
+	"IRQ_Initialize",
+	"SCU + SMP enable",
+	"C runtime start",
+	".bss clear",
+	"Constructors",
+	"tru_bsp_init",
+	"tru_bsp_init done",
+	"main"
+};
+
+// Non-inline version for calling from assembly
+void tru_boot_ts_mark_id(uint32_t stage){
+	tru_boot_ts_mark(stage);
+}
+
+// Called by the C runtime start after the .bss is cleared and before the constructors
+void hardware_init_hook(void){
+	tru_boot_ts_mark(TRU_BOOT_TS_BSS_CLEAR);
+}
+
+// Runs before any constructor without a priority
+__attribute__((constructor(101))) static void tru_boot_ts_ctors(void){
+	tru_boot_ts_mark(TRU_BOOT_TS_CTORS);
+}
+
+/*
+	Prints the recorded stages with the time since the reset handler entry and
+	the time since the previous recorded stage, in microseconds.
+*/
+void tru_boot_ts_print(void){
+	uint32_t valid = TRU_BOOT_TS_BUF->valid;
+	uint32_t mhz = SystemCoreClock / 4U / 1000000U;  // Global timer clock is 1/4 of the processor clock
+	uint32_t t0 = TRU_BOOT_TS_BUF->ticks[TRU_BOOT_TS_RESET];
+	uint32_t prev = t0;
+
+	if((valid & (1UL << TRU_BOOT_TS_RESET)) == 0U){
+		printf("Boot timestamps: none recorded\n");
+		return;
+	}
+
+	printf("Boot timestamps (us)\n");
+	printf("%-26s %12s %12s\n", "stage", "since reset", "delta");
+	for(uint32_t i = 0U; i < TRU_BOOT_TS_COUNT; i++){
+		if(valid & (1UL << i)){
+			uint32_t t = TRU_BOOT_TS_BUF->ticks[i];
+			uint32_t ns = (uint32_t)((uint64_t)(t - t0) * 1000U / mhz);
+			uint32_t delta_ns = (uint32_t)((uint64_t)(t - prev) * 1000U / mhz);
+
+			printf("%-26s %8lu.%03lu %8lu.%03lu\n", tru_boot_ts_names[i], (unsigned long)(ns / 1000U), (unsigned long)(ns % 1000U), (unsigned long)(delta_ns / 1000U), (unsigned long)(delta_ns % 1000U));
+			prev = t;
+		}
+	}
+}
+
+#else
+
+void tru_boot_ts_mark_id(uint32_t stage){
+	(void)stage;
+}
+
+void tru_boot_ts_print(void){
+}
+
+#endif
+
+#endif
@@ -0,0 +1,94 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Boot stage timestamps, from the reset handler up to main().
+
+	Each stage records the lower 32 bits of the Cortex-A9 global timer into a
+	small fixed buffer at the top of the OCRAM (__boot_ts_start in the linker
+	script).  The buffer does not rely on .data or .bss, so it can be written
+	before SystemInit() and before newlib clears the .bss.  The OCRAM is
+	chosen because U-Boot maps it as non-cacheable, so the early stamps are not
+	lost when the startup invalidates the caches.
+
+	The reset handler entry stamp starts the global timer if it is not already
+	running.  Call tru_boot_ts_print() to print the stages as a table.
+*/
+
+#ifndef TRU_BOOT_TS_H
+#define TRU_BOOT_TS_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "arm/tru_cortex_a9.h"
+#include <stdint.h>
+
+// Boot stage IDs in boot order.  Note, these have no U suffix because they are also used in assembly
+#define TRU_BOOT_TS_RESET        0   // Reset_Handler entry
+#define TRU_BOOT_TS_OCRAM        1   // OCRAM copy down done
+#define TRU_BOOT_TS_SYSINIT      2   // SystemInit() entry
+#define TRU_BOOT_TS_INVALIDATE   3   // TLB, branch predictor and L1 cache invalidation done
+#define TRU_BOOT_TS_MMU          4   // MMU translation table created and MMU enabled
+#define TRU_BOOT_TS_L1_ENABLE    5   // L1 caches enabled
+#define TRU_BOOT_TS_L2_ENABLE    6   // L2 cache enabled
+#define TRU_BOOT_TS_TLB_LOCK     7   // TLB entries locked
+#define TRU_BOOT_TS_IRQ_INIT     8   // IRQ_Initialize() done
+#define TRU_BOOT_TS_SCU_SMP      9   // SCU and SMP coherency enabled
+#define TRU_BOOT_TS_START        10  // Calling the C runtime start (newlib _start or _tru_start)
+#define TRU_BOOT_TS_BSS_CLEAR    11  // .bss cleared (hardware_init_hook)
+#define TRU_BOOT_TS_CTORS        12  // First constructor
+#define TRU_BOOT_TS_BSP_INIT     13  // tru_bsp_init() entry
+#define TRU_BOOT_TS_BSP_INIT_END 14  // tru_bsp_init() done
+#define TRU_BOOT_TS_MAIN         15  // main() entry
+#define TRU_BOOT_TS_COUNT        16
+
+typedef struct{
+	uint32_t valid;                     // Bit mask of the recorded stages
+	uint32_t ticks[TRU_BOOT_TS_COUNT];  // Global timer lower 32 bits for each stage
+}tru_boot_ts_t;
+
+extern tru_boot_ts_t __boot_ts_start;  // Reference external symbol name from the linker file
+
+#define TRU_BOOT_TS_BUF ((volatile tru_boot_ts_t *)&__boot_ts_start)
+
+#if defined(TRU_BOOT_TS) && TRU_BOOT_TS == 1U
+	// Records the timestamp of a boot stage.  Safe to call before the .bss is cleared
+	static inline void tru_boot_ts_mark(uint32_t stage){
+		TRU_BOOT_TS_BUF->ticks[stage] = GTIM_REG->counterl;
+		TRU_BOOT_TS_BUF->valid |= 1UL << stage;
+	}
+#else
+	static inline void tru_boot_ts_mark(uint32_t stage){
+		(void)stage;
+	}
+#endif
+
+void tru_boot_ts_mark_id(uint32_t stage);
+void tru_boot_ts_print(void);
+
+#endif
+
+#endif
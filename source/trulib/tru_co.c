@@ -0,0 +1,227 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Stackless cooperative coroutines with a run queue per CPU.
+*/
+
+#include "tru_co.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cache.h"
+#include "arm/tru_atomic.h"
+#include "arm/tru_ipi.h"
+#include <stddef.h>
+
+typedef struct{
+	tru_co_t *head;
+	tru_co_t *tail;
+	volatile uint32_t kicked;    // Something may have become ready since the start of the pass
+	volatile uint32_t sleeping;  // In WFI, or about to be
+}__attribute__((aligned(CACHELINE_SIZE))) tru_co_cpu_t;
+
+static tru_co_cpu_t tru_co_cpus[TRU_CO_CPUS];
+
+static void tru_co_wake_isr(void){
+	// Nothing to do, the IRQ itself wakes the WFI
+}
+
+static void tru_co_gtim_isr(void){
+	gtim_disarm_compare();
+	gtim_clear_event();
+}
+
+// Sets up the wake up IRQs on the calling CPU, which must run tru_co_run() or tru_co_step()
+void tru_co_cpu_init(void){
+	tru_time_ensure_started();
+
+	tru_ipi_set_handler(TRU_CO_WAKE_SGI, tru_co_wake_isr);
+	IRQ_SetHandler(TRU_CO_GTIM_IRQ, tru_co_gtim_isr);
+	tru_ipi_enable(TRU_CO_WAKE_SGI);
+	IRQ_Enable(TRU_CO_GTIM_IRQ);
+}
+
+void tru_co_cpu_exit(void){
+	tru_ipi_disable(TRU_CO_WAKE_SGI);
+	IRQ_Disable(TRU_CO_GTIM_IRQ);
+	gtim_disarm_compare();
+}
+
+void tru_co_init(tru_co_t *co, tru_co_fn_t fn, void *ctx){
+	co->fn = fn;
+	co->ctx = ctx;
+	co->line = 0U;
+	co->wait = TRU_CO_READY;
+	co->event = NULL;
+	co->wake = 0U;
+	co->next = NULL;
+}
+
+// Appends a coroutine to the run queue of a CPU
+void tru_co_add(uint32_t cpu, tru_co_t *co){
+	tru_co_cpu_t *c = &tru_co_cpus[cpu];
+
+	co->next = NULL;
+	if(c->tail == NULL){
+		c->head = co;
+	}else{
+		c->tail->next = co;
+	}
+	c->tail = co;
+	tru_co_kick();
+}
+
+// Wakes the schedulers, for when a TRU_CO_AWAIT condition may have become true
+void tru_co_kick(void){
+	uint32_t self = tru_cpu_id();
+
+	for(uint32_t cpu = 0U; cpu < TRU_CO_CPUS; cpu++){
+		tru_co_cpus[cpu].kicked = 1U;
+	}
+	__DMB();  // The kick is seen before sleeping is read, pairs with tru_co_idle()
+	for(uint32_t cpu = 0U; cpu < TRU_CO_CPUS; cpu++){
+		if(cpu != self && tru_co_cpus[cpu].sleeping) tru_ipi_send(TRU_CO_WAKE_SGI, 1UL << cpu);
+	}
+}
+
+void tru_co_event_init(tru_co_event_t *ev){
+	ev->count = 0U;
+}
+
+// Signals an event, resumes one TRU_CO_AWAIT_EVENT.  Callable from IRQ handlers and either CPU
+void tru_co_event_signal(tru_co_event_t *ev){
+	tru_atomic_add(&ev->count, 1U);
+	tru_co_kick();
+}
+
+// Consumes one signal, returns false if there is none
+static bool tru_co_event_take(tru_co_event_t *ev){
+	uint32_t n;
+
+	while((n = ev->count) != 0U){
+		if(tru_atomic_cas(&ev->count, n, n - 1U)) return true;
+	}
+
+	return false;
+}
+
+// Returns true if the coroutine can run, without running it
+static bool tru_co_is_ready(const tru_co_t *co, uint64_t now){
+	switch(co->wait){
+		case TRU_CO_READY:      return true;
+		case TRU_CO_WAIT_EVENT: return co->event->count != 0U;
+		case TRU_CO_WAIT_TIME:  return now >= co->wake;
+		default:                return false;  // TRU_CO_WAIT_COND relies on tru_co_kick()
+	}
+}
+
+/*
+	Runs one pass over the coroutines of the calling CPU, in the order they
+	were added.  Returns the number that made progress, 0 means the CPU can
+	sleep.  Can be called from an existing main loop instead of tru_co_run().
+*/
+uint32_t tru_co_step(void){
+	tru_co_cpu_t *c = &tru_co_cpus[tru_cpu_id()];
+	uint64_t now = gtim_get_counter();
+	uint32_t progress = 0U;
+	tru_co_t *prev = NULL;
+	tru_co_t *co = c->head;
+
+	c->kicked = 0U;
+	while(co != NULL){
+		tru_co_t *next = co->next;
+		bool run;
+
+		switch(co->wait){
+			case TRU_CO_WAIT_EVENT: run = tru_co_event_take(co->event); break;
+			case TRU_CO_WAIT_TIME:  run = now >= co->wake; break;
+			default:                run = true; break;
+		}
+
+		if(run){
+			uint32_t line = co->line;
+			uint32_t wait = co->wait;
+
+			co->wait = co->fn(co);
+			if(co->wait != TRU_CO_WAIT_COND || wait != TRU_CO_WAIT_COND || co->line != line) progress++;
+
+			if(co->wait == TRU_CO_DONE){
+				// Unlink
+				if(prev == NULL){
+					c->head = next;
+				}else{
+					prev->next = next;
+				}
+				if(c->tail == co) c->tail = prev;
+				co->next = NULL;
+				co = next;
+				continue;
+			}
+		}
+
+		prev = co;
+		co = next;
+	}
+
+	return progress;
+}
+
+// Sleeps until an IRQ, unless something is ready.  The global timer comparator is armed for the earliest sleeper
+static void tru_co_idle(tru_co_cpu_t *c){
+	uint64_t now = gtim_get_counter();
+	uint64_t wake = UINT64_MAX;
+	bool ready = false;
+
+	__disable_irq();  // An IRQ that arrives from here on still ends the WFI
+	c->sleeping = 1U;
+	__DMB();  // Pairs with tru_co_kick()
+
+	for(tru_co_t *co = c->head; co != NULL && !ready; co = co->next){
+		ready = tru_co_is_ready(co, now);
+		if(co->wait == TRU_CO_WAIT_TIME && co->wake < wake) wake = co->wake;
+	}
+
+	if(!ready && !c->kicked){
+		if(wake != UINT64_MAX){
+			gtim_arm_compare(wake);
+		}
+		__DSB();
+		__WFI();
+	}
+
+	c->sleeping = 0U;
+	__enable_irq();
+}
+
+// Runs the coroutines of the calling CPU until all of them are done
+void tru_co_run(void){
+	tru_co_cpu_t *c = &tru_co_cpus[tru_cpu_id()];
+
+	while(c->head != NULL){
+		if(tru_co_step() == 0U) tru_co_idle(c);
+	}
+}
+
+#endif
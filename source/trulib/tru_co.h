@@ -0,0 +1,143 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Stackless cooperative coroutines with a run queue per CPU.
+
+	A coroutine is a function that is called again from where it last
+	suspended, using the switch on __LINE__ technique (protothreads).  It has
+	no stack of its own, so the locals are lost on every suspend, keep the
+	state in the context structure (co->ctx).  Nothing is allocated, the
+	caller provides the tru_co_t.
+
+		static uint32_t rx_task(tru_co_t *co){
+			rx_t *rx = co->ctx;
+
+			TRU_CO_BEGIN(co);
+			while(1){
+				TRU_CO_AWAIT_EVENT(co, &rx->ev);  // Signalled by the UART IRQ
+				parse(rx);
+				TRU_CO_SLEEP(co, tru_time_us_to_ticks(100U));
+			}
+			TRU_CO_END(co);
+		}
+
+	Suspend points:
+		- TRU_CO_YIELD: let the others run
+		- TRU_CO_AWAIT_EVENT: until a tru_co_event_t is signalled, each
+		  signal resumes one await (counting)
+		- TRU_CO_SLEEP: for a number of global timer ticks
+		- TRU_CO_AWAIT: until a condition is true, e.g. a queue is not empty.
+		  The condition is evaluated on every scheduler pass, whoever makes it
+		  true (an IRQ handler or the other CPU) must call tru_co_kick() so an
+		  idle CPU wakes up
+
+	tru_co_run() runs the coroutines added to the calling CPU in the order
+	they were added (round robin), so the schedule only depends on the order
+	of the events.  When a pass makes no progress the CPU sleeps with WFI
+	until an IRQ, with the global timer comparator (banked per CPU) armed for
+	the earliest sleeper.  A signal or kick from the other CPU wakes it with
+	TRU_CO_WAKE_SGI.
+
+	Notes:
+		- Only the CPU that owns a coroutine runs it, add coroutines to a CPU
+		  before its scheduler starts or from one of its coroutines
+		- tru_co owns the global timer comparator and its IRQ on the CPUs
+		  that call tru_co_cpu_init()
+		- Do not use switch statements around a suspend point
+*/
+
+#ifndef TRU_CO_H
+#define TRU_CO_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "arm/tru_cortex_a9.h"
+#include "tru_time.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_CO_CPUS     2U
+#define TRU_CO_WAKE_SGI SGI9_IRQn
+#define TRU_CO_GTIM_IRQ VirtualTimer_IRQn  // Cortex-A9 global timer PPI
+
+// Coroutine function return values, set by the macros below
+#define TRU_CO_READY      0U  // Yielded, run again on the next pass
+#define TRU_CO_WAIT_COND  1U
+#define TRU_CO_WAIT_EVENT 2U
+#define TRU_CO_WAIT_TIME  3U
+#define TRU_CO_DONE       4U
+
+typedef struct{
+	volatile uint32_t count;  // Signals not consumed yet
+}tru_co_event_t;
+
+typedef struct tru_co tru_co_t;
+typedef uint32_t (*tru_co_fn_t)(tru_co_t *co);
+
+struct tru_co{
+	tru_co_fn_t fn;
+	void *ctx;
+	uint32_t line;  // Resume point, 0 = start
+	uint32_t wait;  // Last return value of fn
+	tru_co_event_t *event;
+	uint64_t wake;
+	tru_co_t *next;
+};
+
+#define TRU_CO_BEGIN(co) switch((co)->line){ case 0U:
+#define TRU_CO_END(co)   } (co)->line = 0U; return TRU_CO_DONE
+
+#define TRU_CO_YIELD(co) \
+	do{ (co)->line = __LINE__; return TRU_CO_READY; case __LINE__:; }while(0)
+
+#define TRU_CO_AWAIT(co, cond) \
+	do{ (co)->line = __LINE__; case __LINE__: if(!(cond)) return TRU_CO_WAIT_COND; }while(0)
+
+#define TRU_CO_AWAIT_EVENT(co, ev) \
+	do{ (co)->event = (ev); (co)->line = __LINE__; return TRU_CO_WAIT_EVENT; case __LINE__:; }while(0)
+
+#define TRU_CO_SLEEP(co, ticks) \
+	do{ (co)->wake = gtim_get_counter() + (ticks); (co)->line = __LINE__; return TRU_CO_WAIT_TIME; case __LINE__:; }while(0)
+
+#define TRU_CO_EXIT(co) \
+	do{ (co)->line = 0U; return TRU_CO_DONE; }while(0)
+
+void tru_co_cpu_init(void);
+void tru_co_cpu_exit(void);
+void tru_co_init(tru_co_t *co, tru_co_fn_t fn, void *ctx);
+void tru_co_add(uint32_t cpu, tru_co_t *co);
+uint32_t tru_co_step(void);
+void tru_co_run(void);
+void tru_co_kick(void);
+void tru_co_event_init(tru_co_event_t *ev);
+void tru_co_event_signal(tru_co_event_t *ev);
+
+#endif
+
+#endif
@@ -98,6 +98,27 @@
 	#define TRU_CMSIS TRU_CFG_CMSIS
 #endif
 
+// FreeRTOS build profile (make rtos=freertos).  The port supplies IRQ_Handler and saves the VFP registers per task, so
+// the CMSIS handlers are weak and the IRQ_Handler variants in irq_c5soc.c are not used
+#if defined(TRU_FREERTOS) && TRU_FREERTOS == 1U
+	#define TRU_CMSIS_WEAK_IRQH 1U
+	#define TRU_LAZY_VFP 0U
+	#define TRU_NESTED_IRQ 0U
+#endif
+
+// Preemptive thread kernel (tru_thread.h), it supplies IRQ_Handler like the FreeRTOS profile
+#if !defined(TRU_THREAD) && defined(TRU_CFG_THREAD)
+	#define TRU_THREAD TRU_CFG_THREAD
+#endif
+#if defined(TRU_THREAD) && TRU_THREAD == 1U
+	#if defined(TRU_FREERTOS) && TRU_FREERTOS == 1U
+		#error "TRU_THREAD and the FreeRTOS profile both supply IRQ_Handler, enable only one"
+	#endif
+	#define TRU_CMSIS_WEAK_IRQH 1U
+	#define TRU_LAZY_VFP 0U
+	#define TRU_NESTED_IRQ 0U
+#endif
+
 // This is to support FreeRTOS with CMSIS, set to 1 when using FreeRTOS, else set to 0
 #if !defined(TRU_CMSIS_WEAK_IRQH) && defined(TRU_CFG_CMSIS_WEAK_IRQH)
 	#define TRU_CMSIS_WEAK_IRQH TRU_CFG_CMSIS_WEAK_IRQH
@@ -108,6 +129,16 @@
 	#define TRU_STARTUP TRU_CFG_STARTUP
 #endif
 
+// The CPU1 image of an AMP pair (make amp=1, see c5soc/tru_c5soc_hps_amp.h)
+// CPU0 owns the OCRAM, boot timestamp buffer and the UART, so they are not used by this image
+#if defined(TRU_AMP_CORE1) && TRU_AMP_CORE1 == 1U
+	#define TRU_EXIT_TO_UBOOT 0U
+	#define TRU_OCRAM         0U
+	#define TRU_BOOT_TS       0U
+	#define TRU_PRINT_UART0   0U
+	#define TRU_PRINT_UART1   0U
+#endif
+
 #if !defined(TRU_EXIT_TO_UBOOT) && defined(TRU_CFG_EXIT_TO_UBOOT)
 	#define TRU_EXIT_TO_UBOOT TRU_CFG_EXIT_TO_UBOOT
 #endif
@@ -141,6 +172,44 @@
 	#define TRU_DMA_BUFFER_NONCACHEABLE TRU_CFG_DMA_BUFFER_NONCACHEABLE
 #endif
 
+// Record boot stage timestamps
+#if !defined(TRU_BOOT_TS) && defined(TRU_CFG_BOOT_TS)
+	#define TRU_BOOT_TS TRU_CFG_BOOT_TS
+#endif
+
+// Place tagged code and data in the On-Chip RAM
+#if !defined(TRU_OCRAM) && defined(TRU_CFG_OCRAM)
+	#define TRU_OCRAM TRU_CFG_OCRAM
+#endif
+
+// Preload and lock TLB entries for latency critical regions
+#if !defined(TRU_TLB_LOCK) && defined(TRU_CFG_TLB_LOCK)
+	#define TRU_TLB_LOCK TRU_CFG_TLB_LOCK
+#endif
+
+// Use the fast C runtime start instead of newlib's _start
+#if !defined(TRU_FAST_CRT) && defined(TRU_CFG_FAST_CRT)
+	#define TRU_FAST_CRT TRU_CFG_FAST_CRT
+#endif
+
+// Count the calls and cycles of each IRQ handler, always in DEBUG builds
+#if !defined(TRU_IRQ_STATS) && defined(DEBUG)
+	#define TRU_IRQ_STATS 1U
+#endif
+#if !defined(TRU_IRQ_STATS) && defined(TRU_CFG_IRQ_STATS)
+	#define TRU_IRQ_STATS TRU_CFG_IRQ_STATS
+#endif
+
+// Save the VFP registers in IRQ_Handler only when the handler uses them
+#if !defined(TRU_LAZY_VFP) && defined(TRU_CFG_LAZY_VFP)
+	#define TRU_LAZY_VFP TRU_CFG_LAZY_VFP
+#endif
+
+// Nested, priority-preemptive IRQ_Handler
+#if !defined(TRU_NESTED_IRQ) && defined(TRU_CFG_NESTED_IRQ)
+	#define TRU_NESTED_IRQ TRU_CFG_NESTED_IRQ
+#endif
+
 #if !defined(TRU_USB_LOG_INIT) && defined(TRU_CFG_USB_LOG_INIT)
 	#define TRU_USB_LOG_INIT TRU_CFG_USB_LOG_INIT
 #endif
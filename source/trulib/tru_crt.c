@@ -0,0 +1,162 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_crt.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+#include <stdlib.h>
+
+extern uint32_t __bss_start__;  // Reference external symbol name from the linker file
+extern uint32_t __bss_end__;    // Reference external symbol name from the linker file
+extern uint32_t __data_start;   // Reference external symbol name from the linker file
+extern uint32_t __data_end;     // Reference external symbol name from the linker file
+extern uint32_t __data_load;    // Reference external symbol name from the linker file
+
+// Newlib C runtime functions
+extern void __libc_init_array(void);
+extern void __libc_fini_array(void);
+extern void hardware_init_hook(void) __attribute__((weak));
+extern void software_init_hook(void) __attribute__((weak));
+extern int main(int argc, char *const argv[]);
+
+/*
+	Fills memory with zeros.  The bulk is written in 64 byte blocks from a 32
+	byte aligned address, so each 32 byte store is a full cache line.
+
+	Note, the head and tail loops are kept as loops, without this GCC may
+	replace them with a call to memset().
+*/
+__attribute__((optimize("no-tree-loop-distribute-patterns")))
+void tru_crt_zero(void *dst, size_t len){
+	uint8_t *p = dst;
+	size_t blocks;
+
+	// Head, up to the first 32 byte boundary
+	while(len && ((uintptr_t)p & 31U)){
+		*p++ = 0U;
+		len--;
+	}
+
+	// Bulk, 64 bytes per iteration
+	blocks = len >> 6U;
+	if(blocks){
+#if defined(TRU_NEON) && TRU_NEON == 1U
+		__ASM volatile(
+			"VMOV.I8 q0, #0                 \n"
+			"VMOV.I8 q1, #0                 \n"
+			"1:                             \n"
+			"VST1.8  {d0-d3}, [%0:128]!     \n"
+			"VST1.8  {d0-d3}, [%0:128]!     \n"
+			"SUBS    %1, %1, #1             \n"
+			"BNE     1b                     \n"
+			: "+r" (p), "+r" (blocks)
+			:
+			: "d0", "d1", "d2", "d3", "cc", "memory"
+		);
+#else
+		__ASM volatile(
+			"MOV     r4, #0                 \n"
+			"MOV     r5, #0                 \n"
+			"MOV     r6, #0                 \n"
+			"MOV     r7, #0                 \n"
+			"MOV     r8, #0                 \n"
+			"MOV     r9, #0                 \n"
+			"MOV     r10, #0                \n"
+			"MOV     r12, #0                \n"
+			"1:                             \n"
+			"STMIA   %0!, {r4-r10, r12}     \n"
+			"STMIA   %0!, {r4-r10, r12}     \n"
+			"SUBS    %1, %1, #1             \n"
+			"BNE     1b                     \n"
+			: "+r" (p), "+r" (blocks)
+			:
+			: "r4", "r5", "r6", "r7", "r8", "r9", "r10", "r12", "cc", "memory"
+		);
+#endif
+	}
+
+	// Tail
+	len &= 63U;
+	while(len--) *p++ = 0U;
+}
+
+/*
+	Copies memory with 64 byte NEON loads and stores, and preloads the source
+	a few cache lines ahead.  The source and destination do not need to be
+	aligned.  Without NEON it is a plain byte copy.
+*/
+__attribute__((optimize("no-tree-loop-distribute-patterns")))
+void tru_crt_copy(void *dst, const void *src, size_t len){
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+#if defined(TRU_NEON) && TRU_NEON == 1U
+	size_t blocks = len >> 6U;
+
+	if(blocks){
+		__ASM volatile(
+			"1:                             \n"
+			"PLD     [%1, #192]             \n"
+			"VLD1.8  {d0-d3}, [%1]!         \n"
+			"VLD1.8  {d4-d7}, [%1]!         \n"
+			"VST1.8  {d0-d3}, [%0]!         \n"
+			"VST1.8  {d4-d7}, [%0]!         \n"
+			"SUBS    %2, %2, #1             \n"
+			"BNE     1b                     \n"
+			: "+r" (d), "+r" (s), "+r" (blocks)
+			:
+			: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+		);
+	}
+	len &= 63U;
+#endif
+
+	while(len--) *d++ = *s++;
+}
+
+// Replacement for newlib's _start, see tru_crt.h
+void _tru_start(void){
+	// Copy the .data, only if it is not already at its run address
+	if(&__data_load != &__data_start){
+		tru_crt_copy(&__data_start, &__data_load, (size_t)((uint8_t *)&__data_end - (uint8_t *)&__data_start));
+	}
+
+	// Clear the .bss
+	tru_crt_zero(&__bss_start__, (size_t)((uint8_t *)&__bss_end__ - (uint8_t *)&__bss_start__));
+
+	if(hardware_init_hook) hardware_init_hook();
+	if(software_init_hook) software_init_hook();
+
+	atexit(__libc_fini_array);
+	__libc_init_array();  // Calls .preinit_array, _init and .init_array (constructors)
+
+	exit(main(0, NULL));
+}
+
+#endif
@@ -0,0 +1,61 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Fast C runtime start, used instead of newlib's _start.
+
+	Newlib's _start clears the .bss with the generic memset().  _tru_start()
+	is called by the reset handler after SystemInit() has enabled the MMU and
+	the caches, and clears the .bss with 32 byte NEON stores.  When the L2
+	cache is enabled the Cortex-A9 and L2C-310 "full line of zeros" mode is
+	also enabled by SystemInit(), so a cache line of zeros is written without
+	first reading the line from the DDR.
+
+	The .data is copied with NEON loads and PLD only when its load address
+	differs from its run address.  With the U-Boot loaded image they are the
+	same, so there is nothing to copy.
+
+	The rest is the same as newlib's _start: hardware_init_hook(),
+	software_init_hook(), atexit(__libc_fini_array), __libc_init_array()
+	(.preinit_array, _init and .init_array), then exit(main(0, NULL)).  Note,
+	Semihosting handles are initialised by tru_bsp_init() and the Semihosting
+	command line is not passed to main().
+*/
+
+#ifndef TRU_CRT_H
+#define TRU_CRT_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stddef.h>
+
+void tru_crt_zero(void *dst, size_t len);
+void tru_crt_copy(void *dst, const void *src, size_t len);
+void _tru_start(void) __attribute__((noreturn));
+
+#endif
+
+#endif
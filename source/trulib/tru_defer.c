@@ -0,0 +1,207 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Deferred interrupt work (bottom halves) with priority levels.
+*/
+
+#include "tru_defer.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_queue.h"
+#include "tru_time.h"
+#include "arm/tru_cortex_a9.h"
+#include "arm/tru_ipi.h"
+#include <stddef.h>
+
+typedef struct{
+	tru_defer_fn_t fn;
+	void *arg;
+	uint32_t t_post;  // Global timer, low word
+}tru_defer_item_t;
+
+#define TRU_DEFER_CELL_SIZE TRU_MPMC_CELL_SIZE(sizeof(tru_defer_item_t))
+
+typedef struct{
+	tru_mpmc_t q[TRU_DEFER_LEVELS];
+	tru_defer_stats_t stats[TRU_DEFER_LEVELS];
+	volatile uint32_t draining;  // Stops the SGI handler from draining under tru_defer_run() on the same CPU
+}tru_defer_cpu_t;
+
+static tru_defer_cpu_t tru_defer_cpus[TRU_DEFER_CPUS];
+static uint32_t tru_defer_buf[TRU_DEFER_CPUS][TRU_DEFER_LEVELS][TRU_DEFER_QUEUE_LEN * TRU_DEFER_CELL_SIZE / sizeof(uint32_t)];
+static uint32_t tru_defer_mode;
+static bool tru_defer_ready;
+
+// True if a committed item is waiting at the head of a queue of the CPU, an item still being written by a producer does not count
+static bool tru_defer_pending(const tru_defer_cpu_t *c){
+	for(uint32_t level = 0U; level < TRU_DEFER_LEVELS; level++){
+		const tru_mpmc_t *q = &c->q[level];
+		uint32_t pos = q->deq_pos;
+
+		if(*tru_mpmc_seq(q, pos) == pos + 1U) return true;
+	}
+
+	return false;
+}
+
+static void tru_defer_isr(void){
+	tru_defer_run();
+}
+
+// In SGI mode sets the priority of the SGI and enables it on the calling CPU, both are banked per CPU
+void tru_defer_cpu_init(void){
+	if(tru_defer_mode == TRU_DEFER_MODE_SGI){
+		IRQ_SetPriority(TRU_DEFER_SGI, TRU_DEFER_PRIORITY);
+		tru_ipi_enable(TRU_DEFER_SGI);
+	}
+}
+
+/*
+	Initialises the queues of both CPUs and in SGI mode enables the SGI on the
+	calling CPU.  CPU1 must also call tru_defer_cpu_init() to drain its own
+	queues, e.g. with tru_hps_smp_call_core1().
+	Returns 0 on success, or -1 if already initialised.
+*/
+int tru_defer_init(uint32_t mode){
+	if(tru_defer_ready) return -1;
+
+	for(uint32_t cpu = 0U; cpu < TRU_DEFER_CPUS; cpu++){
+		for(uint32_t level = 0U; level < TRU_DEFER_LEVELS; level++){
+			tru_mpmc_init(&tru_defer_cpus[cpu].q[level], tru_defer_buf[cpu][level], sizeof(tru_defer_item_t), TRU_DEFER_QUEUE_LEN);
+		}
+		tru_defer_cpus[cpu].draining = 0U;
+	}
+	tru_defer_reset_stats();
+
+	tru_time_ensure_started();  // Global timer for the latency
+
+	tru_defer_mode = mode;
+	if(mode == TRU_DEFER_MODE_SGI){
+		tru_ipi_set_handler(TRU_DEFER_SGI, tru_defer_isr);
+	}
+	tru_defer_cpu_init();
+	__DSB();
+	tru_defer_ready = true;
+
+	return 0;
+}
+
+// Disables the SGI on the calling CPU, items still queued are discarded
+void tru_defer_exit(void){
+	if(!tru_defer_ready) return;
+
+	tru_defer_ready = false;
+	if(tru_defer_mode == TRU_DEFER_MODE_SGI){
+		tru_ipi_disable(TRU_DEFER_SGI);
+		tru_ipi_set_handler(TRU_DEFER_SGI, NULL);
+	}
+}
+
+/*
+	Posts a work item to a CPU, callable from IRQ handlers and from either CPU.
+	Returns false if the queue of the level is full, the drop is counted.
+*/
+bool tru_defer_post(uint32_t cpu, uint32_t level, tru_defer_fn_t fn, void *arg){
+	if(!tru_defer_ready || cpu >= TRU_DEFER_CPUS || level >= TRU_DEFER_LEVELS) return false;
+
+	tru_defer_item_t item = { .fn = fn, .arg = arg, .t_post = GTIM_REG->counterl };
+
+	if(!tru_mpmc_push(&tru_defer_cpus[cpu].q[level], &item)){
+		tru_atomic_add(&tru_defer_cpus[cpu].stats[level].dropped, 1U);
+		return false;
+	}
+	if(tru_defer_mode == TRU_DEFER_MODE_SGI){
+		tru_ipi_send(TRU_DEFER_SGI, 1UL << cpu);  // Already pending is fine, one drain runs all items
+	}
+
+	return true;
+}
+
+// Posts a work item to the calling CPU
+bool tru_defer_post_local(uint32_t level, tru_defer_fn_t fn, void *arg){
+	return tru_defer_post(tru_cpu_id(), level, fn, arg);
+}
+
+/*
+	Runs the queued items of the calling CPU, the most urgent level first,
+	until all queues are empty.  Called by the SGI handler, or from the main
+	or idle loop in idle mode.  Returns the number of items run.
+*/
+uint32_t tru_defer_run(void){
+	tru_defer_cpu_t *c = &tru_defer_cpus[tru_cpu_id()];
+	uint32_t n = 0U;
+	tru_defer_item_t item;
+
+	if(!tru_defer_ready || c->draining) return 0U;
+	do{
+		c->draining = 1U;
+
+		for(uint32_t level = 0U; level < TRU_DEFER_LEVELS;){
+			if(!tru_mpmc_pop(&c->q[level], &item)){
+				level++;
+				continue;
+			}
+
+			uint32_t lat = GTIM_REG->counterl - item.t_post;
+			tru_defer_stats_t *s = &c->stats[level];
+
+			s->count++;
+			s->lat_sum += lat;
+			if(lat > s->lat_max) s->lat_max = lat;
+
+			item.fn(item.arg);
+			n++;
+			level = 0U;  // A more urgent item may have been posted meanwhile
+		}
+
+		c->draining = 0U;
+		__DMB();  // Re-check after clearing, an item posted to a drained level while draining was set had its SGI swallowed
+	}while(tru_defer_pending(c));
+
+	return n;
+}
+
+// Copies the statistics of a CPU and level
+void tru_defer_get_stats(uint32_t cpu, uint32_t level, tru_defer_stats_t *stats){
+	if(cpu >= TRU_DEFER_CPUS || level >= TRU_DEFER_LEVELS) return;
+
+	*stats = tru_defer_cpus[cpu].stats[level];
+}
+
+void tru_defer_reset_stats(void){
+	for(uint32_t cpu = 0U; cpu < TRU_DEFER_CPUS; cpu++){
+		for(uint32_t level = 0U; level < TRU_DEFER_LEVELS; level++){
+			tru_defer_stats_t *s = &tru_defer_cpus[cpu].stats[level];
+
+			s->count = 0U;
+			s->dropped = 0U;
+			s->lat_sum = 0U;
+			s->lat_max = 0U;
+		}
+	}
+}
+
+#endif
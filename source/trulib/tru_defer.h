@@ -0,0 +1,101 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Deferred interrupt work (bottom halves) with priority levels.
+
+	An IRQ handler posts a work item (function and argument) with
+	tru_defer_post() and returns, the work runs later with the IRQ unmasked.
+	Each CPU has one lock-free MPMC queue (tru_queue.h) per level, so nested
+	IRQ handlers and the other CPU can post at the same time.  Level 0 is the
+	most urgent, after each item the drain starts again from level 0.
+
+	The queues of a CPU are drained on that CPU, either:
+		- TRU_DEFER_MODE_SGI: by the TRU_DEFER_SGI handler, which is set to
+		  the lowest priority so any other IRQ is served first, and a post
+		  sends the SGI to the target CPU
+		- TRU_DEFER_MODE_IDLE: by calling tru_defer_run() from the main or
+		  idle loop
+
+	Each item is stamped with the global timer when posted, the drain keeps
+	the count, the average and worst post to start latency, and the drops
+	because of a full queue, per CPU and level.
+
+	Notes:
+		- The work runs in IRQ mode (SGI) or in the caller's mode (idle), it
+		  may use the VFP like any IRQ handler
+		- Without TRU_NESTED_IRQ (irq_c5soc.c) a long item in SGI mode still
+		  delays the other IRQs of the CPU, keep them short or use the idle
+		  mode
+		- The global timer is started if it is not running
+*/
+
+#ifndef TRU_DEFER_H
+#define TRU_DEFER_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_DEFER_CPUS      2U
+#define TRU_DEFER_LEVELS    3U
+#define TRU_DEFER_QUEUE_LEN 32U     // Items per CPU and level, must be a power of two
+#define TRU_DEFER_SGI       SGI6_IRQn
+#define TRU_DEFER_PRIORITY  0xF0U   // Lowest, below every other IRQ
+
+// Levels
+#define TRU_DEFER_HIGH   0U
+#define TRU_DEFER_NORMAL 1U
+#define TRU_DEFER_LOW    2U
+
+// Drain modes
+#define TRU_DEFER_MODE_SGI  0U
+#define TRU_DEFER_MODE_IDLE 1U
+
+typedef void (*tru_defer_fn_t)(void *arg);
+
+typedef struct{
+	uint32_t count;     // Items run
+	uint32_t dropped;   // Posts that failed because the queue was full
+	uint64_t lat_sum;   // Post to start latency, global timer ticks
+	uint32_t lat_max;
+}tru_defer_stats_t;
+
+int tru_defer_init(uint32_t mode);
+void tru_defer_cpu_init(void);
+void tru_defer_exit(void);
+bool tru_defer_post(uint32_t cpu, uint32_t level, tru_defer_fn_t fn, void *arg);
+bool tru_defer_post_local(uint32_t level, tru_defer_fn_t fn, void *arg);
+uint32_t tru_defer_run(void);
+void tru_defer_get_stats(uint32_t cpu, uint32_t level, tru_defer_stats_t *stats);
+void tru_defer_reset_stats(void);
+
+#endif
+
+#endif
@@ -0,0 +1,178 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Statistical profiler sampling the interrupted PC and LR from the
+	Cortex-A9 private timer.
+*/
+
+#include "tru_prof.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cache.h"
+#include "arm/tru_cortex_a9.h"
+#include "arm/tru_fiq.h"
+
+#define TRU_PROF_MODE_MSK 0x1FU
+#define TRU_PROF_MODE_USR 0x10U
+#define TRU_PROF_MODE_SYS 0x1FU
+
+typedef struct{
+	volatile uint32_t count;
+	volatile uint32_t dropped;
+	uint32_t rate_hz;
+}__attribute__((aligned(CACHELINE_SIZE))) tru_prof_cpu_t;
+
+static tru_prof_cpu_t tru_prof_cpus[TRU_PROF_CPUS];
+static tru_prof_sample_t tru_prof_buf[TRU_PROF_CPUS][TRU_PROF_SAMPLES];
+
+/*
+	Reads LR of the interrupted mode, by switching to it with the IRQ and
+	FIQ still masked.  User mode shares its registers with SYS mode.  Only
+	r0-r2 are used, r8-r14 are banked in FIQ mode.
+*/
+static inline uint32_t tru_prof_banked_lr(uint32_t cpsr){
+	uint32_t mode = cpsr & TRU_PROF_MODE_MSK;
+	register uint32_t r0 __ASM("r0") = (mode == TRU_PROF_MODE_USR) ? TRU_PROF_MODE_SYS : mode;
+
+	__ASM volatile(
+		"MRS    r1, cpsr                      \n"
+		"BIC    r2, r1, #0x1F                 \n"
+		"ORR    r2, r2, r0                    \n"
+		"MSR    cpsr_c, r2                    \n"  // Interrupted mode
+		"MOV    r0, lr                        \n"
+		"MSR    cpsr_c, r1                    \n"  // Back to FIQ mode
+		: "+r" (r0)
+		:
+		: "r1", "r2", "memory"
+	);
+	return r0;
+}
+
+// FIQ callback, integer only (the VFP is not saved)
+static void tru_prof_fiq(const tru_fiq_frame_t *frame){
+	uint32_t cpu = tru_cpu_id();
+	tru_prof_cpu_t *c = &tru_prof_cpus[cpu];
+	uint32_t n = c->count;
+	uint32_t cpsr;
+
+	ptim_clear_event();
+	if(n < TRU_PROF_SAMPLES){
+		volatile tru_prof_sample_t *s = &tru_prof_buf[cpu][n];
+
+		__ASM volatile("MRS    %0, spsr" : "=r" (cpsr));  // CPSR of the interrupted code
+		s->pc = frame->pc;
+		s->lr = tru_prof_banked_lr(cpsr);
+		s->cpsr = cpsr;
+		c->count = n + 1U;
+	}else{
+		c->dropped++;
+	}
+}
+
+// Called instead if IRQ_Handler acknowledges the timer while the FIQ is masked, the sample is lost
+static void tru_prof_irq(void){
+	ptim_clear_event();
+	tru_prof_cpus[tru_cpu_id()].dropped++;
+}
+
+// Starts sampling the calling CPU at rate_hz, appending to its buffer
+void tru_prof_start(uint32_t rate_hz){
+	tru_prof_cpu_t *c = &tru_prof_cpus[tru_cpu_id()];
+	uint32_t periph_hz = SystemCoreClock / 4U;  // The private timer runs at 1/4 of the processor clock
+
+	if(rate_hz == 0U || rate_hz > periph_hz) return;
+	c->rate_hz = rate_hz;
+
+	ptim_setup_basic_mode();
+	PTIM_REG->load = periph_hz / rate_hz - 1U;  // Also loads the counter
+	ptim_clear_event();
+	PTIM_REG->control.val |= PTIM_CONTROL_AUTORELOAD_MSK | PTIM_CONTROL_IRQ_ENABLE_MSK;
+
+	tru_fiq_init_frame(TRU_PROF_IRQ, tru_prof_fiq, tru_prof_irq);
+	IRQ_Enable(TRU_PROF_IRQ);
+	ptim_enable();
+}
+
+// Stops sampling the calling CPU and gives the private timer interrupt back to IRQ_Handler
+void tru_prof_stop(void){
+	ptim_disable();
+	PTIM_REG->control.val &= ~PTIM_CONTROL_IRQ_ENABLE_MSK;
+	ptim_clear_event();
+
+	// As tru_fiq_exit(), but only for the banked PPI and CPU interface of this CPU
+	IRQ_Disable(TRU_PROF_IRQ);
+	GICInterface->CTLR &= ~TRU_GICC_CTLR_FIQEN;
+	GIC_SetGroup(TRU_PROF_IRQ, 1U);
+	IRQ_SetHandler(TRU_PROF_IRQ, NULL);
+	__DSB();
+}
+
+// Empties the buffers, call with the sampling stopped
+void tru_prof_reset(void){
+	for(uint32_t cpu = 0U; cpu < TRU_PROF_CPUS; cpu++){
+		tru_prof_cpus[cpu].count = 0U;
+		tru_prof_cpus[cpu].dropped = 0U;
+	}
+}
+
+uint32_t tru_prof_count(uint32_t cpu){
+	return tru_prof_cpus[cpu].count;
+}
+
+uint32_t tru_prof_dropped(uint32_t cpu){
+	return tru_prof_cpus[cpu].dropped;
+}
+
+const tru_prof_sample_t *tru_prof_samples(uint32_t cpu){
+	return tru_prof_buf[cpu];
+}
+
+/*
+	Prints the samples for scripts-linux/prof-symbolize.py:
+		# tru_prof
+		cpu <n> rate <Hz> samples <count> dropped <count>
+		<pc> <lr> <cpsr>    (hex, one line per sample)
+		end
+*/
+void tru_prof_dump(FILE *f){
+	fprintf(f, "# tru_prof\n");
+	for(uint32_t cpu = 0U; cpu < TRU_PROF_CPUS; cpu++){
+		tru_prof_cpu_t *c = &tru_prof_cpus[cpu];
+		uint32_t n = c->count;
+
+		if(n == 0U && c->dropped == 0U) continue;
+		fprintf(f, "cpu %lu rate %lu samples %lu dropped %lu\n", (unsigned long)cpu, (unsigned long)c->rate_hz, (unsigned long)n, (unsigned long)c->dropped);
+		for(uint32_t i = 0U; i < n; i++){
+			const tru_prof_sample_t *s = &tru_prof_buf[cpu][i];
+
+			fprintf(f, "%08lx %08lx %08lx\n", (unsigned long)s->pc, (unsigned long)s->lr, (unsigned long)s->cpsr);
+		}
+	}
+	fprintf(f, "end\n");
+	fflush(f);
+}
+
+#endif
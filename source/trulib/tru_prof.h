@@ -0,0 +1,90 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Statistical profiler sampling the interrupted PC and LR from the
+	Cortex-A9 private timer.
+
+	The private timer interrupt (PPI 29, banked per CPU) is routed as a FIQ
+	(tru_fiq.h), so the samples also land inside IRQ handlers and code that
+	runs with the IRQ masked.  Each sample records the interrupted PC, its
+	LR (read from the banked register of the interrupted mode) and its CPSR,
+	into a RAM buffer per CPU.  The buffer stops filling when full, the
+	samples after that are only counted.
+
+	tru_prof_dump() prints the samples as text to a stream: stdout, which is
+	the UART or the semihosting console, or a host file opened with fopen()
+	under semihosting.  scripts-linux/prof-symbolize.py turns them into a
+	flat profile and a collapsed stack file for flamegraph.pl:
+		python3 scripts-linux/prof-symbolize.py Debug/app.elf prof.txt --collapsed prof.folded
+
+	Usage:
+		tru_prof_start(10000U);  // 10 kHz on the calling CPU, CPU1 calls it too to be sampled
+		work();
+		tru_prof_stop();
+		tru_prof_dump(stdout);
+
+	Notes:
+		- The "stack" is two frames deep: the caller is where LR points, which
+		  is exact in leaf functions and in the prologue and epilogue, and may
+		  be stale in the body of a function that has made a call
+		- Takes over the private timer (the FreeRTOS tick) and the FIQ
+		  (tru_fiq.h, bench_fiq) of the CPU
+		- The sample rate is limited by the FIQ cost, about 100 cycles, 10 to
+		  50 kHz keeps the overhead below 1%
+*/
+
+#ifndef TRU_PROF_H
+#define TRU_PROF_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRU_PROF_CPUS    2U
+#define TRU_PROF_SAMPLES 16384U              // Per CPU
+#define TRU_PROF_IRQ     SecurePhyTimer_IRQn  // Cortex-A9 private timer PPI
+
+typedef struct{
+	uint32_t pc;
+	uint32_t lr;
+	uint32_t cpsr;
+}tru_prof_sample_t;
+
+void tru_prof_start(uint32_t rate_hz);
+void tru_prof_stop(void);
+void tru_prof_reset(void);
+uint32_t tru_prof_count(uint32_t cpu);
+uint32_t tru_prof_dropped(uint32_t cpu);
+const tru_prof_sample_t *tru_prof_samples(uint32_t cpu);
+void tru_prof_dump(FILE *f);
+
+#endif
+
+#endif
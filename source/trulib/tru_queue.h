@@ -0,0 +1,285 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Lock-free bounded queues, header only.
+
+	tru_spsc_t: single producer, single consumer, wait-free.  Meant for an IRQ
+	handler handing data to the main loop, or one CPU feeding the other.  The
+	producer only writes head and the consumer only writes tail, each keeps a
+	cached copy of the other index so the shared line is only read when the
+	queue looks full or empty.
+
+	tru_mpmc_t: multiple producers and consumers, bounded (Vyukov's queue).
+	Each cell has a sequence number that says whether it is free for the
+	producer or filled for the consumer of the current lap, a position is
+	claimed with a CAS on the enqueue or dequeue index.
+
+	Both are generic over the element size, which is set at init and copied
+	with memcpy().  The length must be a power of two.  The indexes are on
+	separate cache lines so the producer and consumer do not false share.
+	The _n functions move up to n elements with one set of barriers, they
+	return the number moved.
+
+	The caller provides the storage:
+		- tru_spsc_t: len * elem_size bytes
+		- tru_mpmc_t: len * TRU_MPMC_CELL_SIZE(elem_size) bytes, 4 byte aligned
+
+	See arm/tru_atomic.h for the memory requirements between the CPUs.  On a
+	single CPU an MPMC enqueue from an IRQ handler is fine, but a main loop
+	preempted in the middle of an enqueue blocks the consumer of that cell
+	until it resumes.
+*/
+
+#ifndef TRU_QUEUE_H
+#define TRU_QUEUE_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cache.h"
+#include "arm/tru_atomic.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define TRU_QUEUE_IS_POW2(len)       ((len) != 0U && ((len) & ((len) - 1U)) == 0U)
+#define TRU_MPMC_CELL_SIZE(elem_size) (4U + (((elem_size) + 3U) & ~3U))  // Sequence number and the element rounded up to a word
+
+// ====
+// SPSC
+// ====
+
+typedef struct{
+	// Read only after init
+	uint8_t *buf;
+	uint32_t mask;
+	uint32_t elem_size;
+
+	// Producer
+	volatile uint32_t head __attribute__((aligned(CACHELINE_SIZE)));
+	uint32_t tail_cache;
+
+	// Consumer
+	volatile uint32_t tail __attribute__((aligned(CACHELINE_SIZE)));
+	uint32_t head_cache;
+}__attribute__((aligned(CACHELINE_SIZE))) tru_spsc_t;
+
+// Returns 0 on success, or -1 if len is not a power of two
+static inline int tru_spsc_init(tru_spsc_t *q, void *buf, uint32_t elem_size, uint32_t len){
+	if(!TRU_QUEUE_IS_POW2(len)) return -1;
+
+	q->buf = buf;
+	q->mask = len - 1U;
+	q->elem_size = elem_size;
+	q->head = 0U;
+	q->tail_cache = 0U;
+	q->tail = 0U;
+	q->head_cache = 0U;
+	__dmb();
+
+	return 0;
+}
+
+// Copies n elements between the ring and a linear buffer, splitting at the wrap around
+static inline void tru_spsc_copy(tru_spsc_t *q, uint32_t pos, void *linear, uint32_t n, bool to_ring){
+	uint32_t idx = pos & q->mask;
+	uint32_t first = q->mask + 1U - idx;
+	uint8_t *ring = q->buf + idx * q->elem_size;
+
+	if(first > n) first = n;
+	if(to_ring){
+		memcpy(ring, linear, first * q->elem_size);
+		memcpy(q->buf, (uint8_t *)linear + first * q->elem_size, (n - first) * q->elem_size);
+	}else{
+		memcpy(linear, ring, first * q->elem_size);
+		memcpy((uint8_t *)linear + first * q->elem_size, q->buf, (n - first) * q->elem_size);
+	}
+}
+
+// Producer side, returns the number of elements pushed
+static inline uint32_t tru_spsc_push_n(tru_spsc_t *q, const void *elems, uint32_t n){
+	uint32_t head = q->head;
+	uint32_t len = q->mask + 1U;
+
+	// Only read the consumer index when the cached one says there is no room
+	if(len - (head - q->tail_cache) < n) q->tail_cache = tru_atomic_load(&q->tail);
+	uint32_t room = len - (head - q->tail_cache);
+	if(n > room) n = room;
+	if(n == 0U) return 0U;
+
+	tru_spsc_copy(q, head, (void *)elems, n, true);
+	tru_atomic_store(&q->head, head + n);  // The elements are written before they are published
+
+	return n;
+}
+
+// Consumer side, returns the number of elements popped
+static inline uint32_t tru_spsc_pop_n(tru_spsc_t *q, void *elems, uint32_t n){
+	uint32_t tail = q->tail;
+
+	// Only read the producer index when the cached one says there is not enough
+	if(q->head_cache - tail < n) q->head_cache = tru_atomic_load(&q->head);
+	uint32_t avail = q->head_cache - tail;
+	if(n > avail) n = avail;
+	if(n == 0U) return 0U;
+
+	tru_spsc_copy(q, tail, elems, n, false);
+	tru_atomic_store(&q->tail, tail + n);  // The elements are read before the space is given back
+
+	return n;
+}
+
+// Returns true if pushed, false if the queue is full
+static inline bool tru_spsc_push(tru_spsc_t *q, const void *elem){
+	return tru_spsc_push_n(q, elem, 1U) == 1U;
+}
+
+// Returns true if popped, false if the queue is empty
+static inline bool tru_spsc_pop(tru_spsc_t *q, void *elem){
+	return tru_spsc_pop_n(q, elem, 1U) == 1U;
+}
+
+// Number of elements in the queue, a snapshot when called from the other side
+static inline uint32_t tru_spsc_count(const tru_spsc_t *q){
+	return q->head - q->tail;
+}
+
+// ====
+// MPMC
+// ====
+
+typedef struct{
+	// Read only after init
+	uint8_t *buf;
+	uint32_t mask;
+	uint32_t elem_size;
+	uint32_t cell_size;
+
+	volatile uint32_t enq_pos __attribute__((aligned(CACHELINE_SIZE)));
+	volatile uint32_t deq_pos __attribute__((aligned(CACHELINE_SIZE)));
+}__attribute__((aligned(CACHELINE_SIZE))) tru_mpmc_t;
+
+static inline volatile uint32_t *tru_mpmc_seq(const tru_mpmc_t *q, uint32_t pos){
+	return (volatile uint32_t *)(q->buf + (pos & q->mask) * q->cell_size);
+}
+
+static inline void *tru_mpmc_data(const tru_mpmc_t *q, uint32_t pos){
+	return q->buf + (pos & q->mask) * q->cell_size + 4U;
+}
+
+// Returns 0 on success, or -1 if len is not a power of two
+static inline int tru_mpmc_init(tru_mpmc_t *q, void *buf, uint32_t elem_size, uint32_t len){
+	if(!TRU_QUEUE_IS_POW2(len)) return -1;
+
+	q->buf = buf;
+	q->mask = len - 1U;
+	q->elem_size = elem_size;
+	q->cell_size = TRU_MPMC_CELL_SIZE(elem_size);
+	for(uint32_t i = 0U; i < len; i++) *tru_mpmc_seq(q, i) = i;  // All cells free for the first lap
+	q->enq_pos = 0U;
+	q->deq_pos = 0U;
+	__dmb();
+
+	return 0;
+}
+
+/*
+	Claims up to n consecutive cells whose sequence is pos + i + offset, i.e.
+	free cells (offset 0) or filled cells (offset 1).  Returns the number
+	claimed with their first position in *first.
+*/
+static inline uint32_t tru_mpmc_claim(tru_mpmc_t *q, volatile uint32_t *index, uint32_t n, uint32_t offset, uint32_t *first){
+	uint32_t pos = *index;
+
+	while(1){
+		uint32_t k = 0U;
+		int32_t diff = 0;
+
+		// Count the cells that are ready for this position
+		while(k < n){
+			diff = (int32_t)(*tru_mpmc_seq(q, pos + k) - (pos + k + offset));
+			if(diff != 0) break;
+			k++;
+		}
+
+		if(k > 0U){
+			if(tru_atomic_cas(index, pos, pos + k)){
+				*first = pos;
+				return k;
+			}
+		}else if(diff < 0){
+			return 0U;  // Full or empty
+		}
+
+		pos = *index;  // Another CPU moved the index, try again from there
+	}
+}
+
+// Returns the number of elements pushed
+static inline uint32_t tru_mpmc_push_n(tru_mpmc_t *q, const void *elems, uint32_t n){
+	uint32_t pos;
+
+	n = tru_mpmc_claim(q, &q->enq_pos, n, 0U, &pos);
+	if(n == 0U) return 0U;
+
+	for(uint32_t i = 0U; i < n; i++){
+		memcpy(tru_mpmc_data(q, pos + i), (const uint8_t *)elems + i * q->elem_size, q->elem_size);
+	}
+	__dmb();  // The elements are written before they are published
+	for(uint32_t i = 0U; i < n; i++) *tru_mpmc_seq(q, pos + i) = pos + i + 1U;
+
+	return n;
+}
+
+// Returns the number of elements popped
+static inline uint32_t tru_mpmc_pop_n(tru_mpmc_t *q, void *elems, uint32_t n){
+	uint32_t pos;
+
+	n = tru_mpmc_claim(q, &q->deq_pos, n, 1U, &pos);
+	if(n == 0U) return 0U;
+
+	for(uint32_t i = 0U; i < n; i++){
+		memcpy((uint8_t *)elems + i * q->elem_size, tru_mpmc_data(q, pos + i), q->elem_size);
+	}
+	__dmb();  // The elements are read before the cells are freed
+	for(uint32_t i = 0U; i < n; i++) *tru_mpmc_seq(q, pos + i) = pos + i + q->mask + 1U;  // Free for the next lap
+
+	return n;
+}
+
+// Returns true if pushed, false if the queue is full
+static inline bool tru_mpmc_push(tru_mpmc_t *q, const void *elem){
+	return tru_mpmc_push_n(q, elem, 1U) == 1U;
+}
+
+// Returns true if popped, false if the queue is empty
+static inline bool tru_mpmc_pop(tru_mpmc_t *q, void *elem){
+	return tru_mpmc_pop_n(q, elem, 1U) == 1U;
+}
+
+#endif
+
+#endif
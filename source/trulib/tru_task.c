@@ -0,0 +1,232 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Two-CPU task runtime with work stealing, and tru_parallel_for().
+*/
+
+#include "tru_task.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "tru_cache.h"
+#include "arm/tru_atomic.h"
+#include "c5soc/tru_c5soc_hps_smp.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define TRU_TASK_DEQUE_MASK (TRU_TASK_DEQUE_LEN - 1U)
+
+typedef struct{
+	tru_task_fn_t fn;
+	void *ctx;
+	uint32_t grain;
+	volatile uint32_t remaining;  // Iterations not done yet
+}tru_task_job_t;
+
+typedef struct{
+	tru_task_job_t *job;
+	uint32_t begin;
+	uint32_t end;
+}tru_task_t;
+
+typedef struct{
+	volatile uint32_t top __attribute__((aligned(CACHELINE_SIZE)));     // Steal end, only moved with a CAS
+	volatile uint32_t bottom __attribute__((aligned(CACHELINE_SIZE)));  // Owner end
+	tru_task_t buf[TRU_TASK_DEQUE_LEN];
+}tru_task_deque_t;
+
+static tru_task_deque_t tru_task_deques[TRU_TASK_CPUS];
+static volatile uint32_t tru_task_running;
+static volatile uint32_t tru_task_stop;
+
+// ============================
+// Chase-Lev deque (fixed size)
+// ============================
+
+// Owner only.  Returns false if full
+static bool tru_task_push(tru_task_deque_t *d, const tru_task_t *task){
+	uint32_t b = d->bottom;
+
+	if((int32_t)(b - d->top) >= (int32_t)TRU_TASK_DEQUE_LEN) return false;
+	d->buf[b & TRU_TASK_DEQUE_MASK] = *task;
+	__dmb();  // The task is written before it is published
+	d->bottom = b + 1U;
+
+	return true;
+}
+
+// Owner only.  Returns false if empty, or the last task was stolen
+static bool tru_task_pop(tru_task_deque_t *d, tru_task_t *task){
+	uint32_t b = d->bottom - 1U;
+
+	d->bottom = b;
+	__dmb();  // The bottom store is seen before top is read, so the owner and a thief cannot both take the last task
+	uint32_t t = d->top;
+
+	if((int32_t)(b - t) < 0){
+		d->bottom = b + 1U;  // Empty
+		return false;
+	}
+
+	*task = d->buf[b & TRU_TASK_DEQUE_MASK];
+	if(b != t) return true;
+
+	// Last task, race the thief for it
+	bool ok = tru_atomic_cas(&d->top, t, t + 1U);
+	d->bottom = b + 1U;
+
+	return ok;
+}
+
+// Other CPU.  Returns false if empty or the owner or another thief won
+static bool tru_task_steal(tru_task_deque_t *d, tru_task_t *task){
+	uint32_t t = d->top;
+
+	__dmb();  // Read top before bottom
+	uint32_t b = d->bottom;
+
+	if((int32_t)(b - t) <= 0) return false;
+	__dmb();  // Acquire, pairs with the DMB in tru_task_push(): the slot is not read before the bottom that published it
+
+	tru_task_t tmp = d->buf[t & TRU_TASK_DEQUE_MASK];  // The slot cannot be reused while top is still t
+	if(!tru_atomic_cas(&d->top, t, t + 1U)) return false;
+	*task = tmp;
+
+	return true;
+}
+
+// =======
+// Runtime
+// =======
+
+static bool tru_task_get(uint32_t cpu, tru_task_t *task){
+	return tru_task_pop(&tru_task_deques[cpu], task) || tru_task_steal(&tru_task_deques[cpu ^ 1U], task);
+}
+
+static void tru_task_run(const tru_task_t *task){
+	tru_task_deque_t *d = &tru_task_deques[tru_cpu_id()];
+	tru_task_job_t *job = task->job;
+	uint32_t begin = task->begin;
+	uint32_t end = task->end;
+
+	// Give away the upper halves while the range is larger than the grain
+	while(end - begin > job->grain){
+		uint32_t mid = begin + (end - begin) / 2U;
+		tru_task_t upper = { job, mid, end };
+
+		if(!tru_task_push(d, &upper)) break;  // Full, do the rest here
+		__dsb();
+		__sev();  // Wake the other CPU to steal it
+		end = mid;
+	}
+
+	job->fn(begin, end, job->ctx);
+
+	// Last access to the job, the caller may return as soon as it reaches 0
+	if(tru_atomic_sub(&job->remaining, end - begin) == 0U){
+		__dsb();
+		__sev();
+	}
+}
+
+// CPU1 loop, runs tasks until tru_task_exit()
+static void tru_task_worker(void *arg){
+	uint32_t cpu = tru_cpu_id();
+	tru_task_t task;
+
+	(void)arg;
+	while(!tru_task_stop){
+		if(tru_task_get(cpu, &task)){
+			tru_task_run(&task);
+		}else{
+			__wfe();  // An SEV after the checks above makes this fall through
+		}
+	}
+}
+
+/*
+	Starts CPU1 if it is not running yet and hands it the worker loop.  Called
+	from CPU0.  Returns 0 on success, or -1 if CPU1 cannot be started or is
+	busy.
+*/
+int tru_task_init(void){
+	if(tru_task_running) return 0;
+
+	for(uint32_t i = 0U; i < TRU_TASK_CPUS; i++){
+		tru_task_deques[i].top = 0U;
+		tru_task_deques[i].bottom = 0U;
+	}
+	tru_task_stop = 0U;
+
+	if(!tru_hps_smp_boot.started && tru_hps_smp_start_core1()) return -1;
+	if(tru_hps_smp_call_core1(tru_task_worker, NULL)) return -1;
+	tru_task_running = 1U;
+
+	return 0;
+}
+
+// Stops the worker loop on CPU1, it goes back to waiting in main_core1()
+void tru_task_exit(void){
+	if(!tru_task_running) return;
+
+	tru_task_stop = 1U;
+	__dsb();
+	__sev();
+	while(tru_hps_smp_core1_busy());
+	tru_task_running = 0U;
+}
+
+/*
+	Calls fn(b, e, ctx) for sub ranges [b, e) covering [begin, end), split
+	between both CPUs.  Each sub range is at most grain long, except when a
+	deque is full.  Returns when all are done.
+*/
+void tru_parallel_for(uint32_t begin, uint32_t end, uint32_t grain, tru_task_fn_t fn, void *ctx){
+	if(end <= begin) return;
+	if(!tru_task_running){
+		fn(begin, end, ctx);
+		return;
+	}
+
+	uint32_t cpu = tru_cpu_id();
+	tru_task_job_t job = { fn, ctx, grain ? grain : 1U, end - begin };
+	tru_task_t task = { &job, begin, end };
+
+	tru_task_run(&task);
+
+	// Help with the rest, which may include tasks of other jobs
+	while(job.remaining != 0U){
+		if(tru_task_get(cpu, &task)){
+			tru_task_run(&task);
+		}else{
+			__wfe();
+		}
+	}
+	__dmb();  // The results of the other CPU are seen after the completion
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Two-CPU task runtime with work stealing, and tru_parallel_for().
+
+	Each CPU has a Chase-Lev deque of range tasks.  The owner pushes and pops
+	at the bottom, the other CPU steals from the top, so they only contend
+	when one task is left.  tru_parallel_for() pushes the whole range as one
+	task.  Running a task splits its range in halves, pushing the upper half
+	and keeping the lower, until it is no more than the grain, which is then
+	passed to fn.  So the idle CPU steals the largest pieces first and the
+	owner keeps working on the small ones in cache order.
+
+	tru_task_init() starts CPU1 (if needed) and runs the worker loop on it via
+	tru_hps_smp_call_core1(), so main_core1() must be the default one.  An idle
+	CPU sleeps with WFE, a push wakes it with SEV.  The caller of
+	tru_parallel_for() takes part in the work and returns when the whole range
+	is done.  Without tru_task_init() it runs the range on the caller.
+
+	Notes:
+		- fn must be safe to run on both CPUs at the same time, e.g. no newlib
+		  calls (see tru_c5soc_hps_smp.h)
+		- fn can call tru_parallel_for() itself, but do not call it from an IRQ
+		  handler, each deque must only be pushed by one context
+		- See arm/tru_atomic.h for the memory requirements between the CPUs
+
+	References:
+		- Chase and Lev, Dynamic Circular Work-Stealing Deque
+		- Le, Pop, Cohen and Zappa Nardelli, Correct and Efficient Work-Stealing
+		  for Weak Memory Models
+*/
+
+#ifndef TRU_TASK_H
+#define TRU_TASK_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include <stdint.h>
+
+#define TRU_TASK_CPUS      2U
+#define TRU_TASK_DEQUE_LEN 64U  // Must be a power of two.  Splitting in halves needs about log2(range / grain) entries
+
+typedef void (*tru_task_fn_t)(uint32_t begin, uint32_t end, void *ctx);
+
+int tru_task_init(void);
+void tru_task_exit(void);
+void tru_parallel_for(uint32_t begin, uint32_t end, uint32_t grain, tru_task_fn_t fn, void *ctx);
+
+#endif
+
+#endif
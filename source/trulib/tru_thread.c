@@ -0,0 +1,563 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Minimal preemptive kernel with a run queue per CPU, see tru_thread.h.
+*/
+
+#include "tru_thread.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_THREAD) && TRU_THREAD == 1U
+
+#include "tru_cache.h"
+#include "irq_c5soc.h"
+#include "arm/tru_ipi.h"
+#include <stddef.h>
+#include <string.h>
+
+#define TRU_THREAD_FPEXC_EN    0x40000000U
+#define TRU_THREAD_CPSR_I      0x80U
+#define TRU_THREAD_CPSR_T      0x20U
+#define TRU_THREAD_CPSR_SYS    0x1FU  // SYS mode, IRQ and FIQ enabled
+#define TRU_THREAD_FRAME_WORDS 16U    // r0-r12, lr, pc, cpsr
+
+typedef struct{
+	tru_spinlock_t lock;
+	volatile uint32_t bitmap;               // Bit n = head[n] is not empty
+	tru_thread_t *head[TRU_THREAD_PRIOS];   // Ready threads per priority, FIFO
+	tru_thread_t *tail[TRU_THREAD_PRIOS];
+	tru_thread_t *current;                  // NULL = tru_thread_run() is not running on this CPU
+	tru_thread_t *sleepers;                 // Sorted by wake time
+	volatile uint32_t alive;                // Threads created and not exited yet
+	volatile uint32_t in_irq;               // In IRQ_Handler, the switch is done on the way out
+#if TRU_THREAD_VFP == 1U
+	tru_thread_t *vfp_owner;                // Thread whose VFP context is in the registers
+#endif
+	tru_thread_t idle;
+}__attribute__((aligned(CACHELINE_SIZE))) tru_thread_rq_t;
+
+static tru_thread_rq_t tru_thread_rqs[TRU_THREAD_CPUS];
+
+// ==========
+// Run queues
+// ==========
+
+// The queue functions are called with the lock of the queue held
+
+static inline void tru_thread_push_tail(tru_thread_rq_t *rq, tru_thread_t *t){
+	t->next = NULL;
+	if(rq->head[t->prio] == NULL){
+		rq->head[t->prio] = t;
+	}else{
+		rq->tail[t->prio]->next = t;
+	}
+	rq->tail[t->prio] = t;
+	rq->bitmap |= 1UL << t->prio;
+}
+
+static inline void tru_thread_push_head(tru_thread_rq_t *rq, tru_thread_t *t){
+	t->next = rq->head[t->prio];
+	if(t->next == NULL) rq->tail[t->prio] = t;
+	rq->head[t->prio] = t;
+	rq->bitmap |= 1UL << t->prio;
+}
+
+// The queue must not be empty, the idle thread is always ready or running
+static inline tru_thread_t *tru_thread_pop_highest(tru_thread_rq_t *rq){
+	uint32_t prio = 31U - __CLZ(rq->bitmap);
+	tru_thread_t *t = rq->head[prio];
+
+	rq->head[prio] = t->next;
+	if(t->next == NULL) rq->bitmap &= ~(1UL << prio);
+	return t;
+}
+
+// Arms the global timer comparator of the calling CPU for the earliest sleeper
+static void tru_thread_arm(tru_thread_rq_t *rq){
+	uint64_t wake = rq->sleepers->wake;
+
+	gtim_arm_compare(wake);
+
+	// Already due, the comparator may not fire for a value in the past
+	if(gtim_get_counter() >= wake) tru_ipi_send_self(TRU_THREAD_SGI);
+}
+
+// Makes the threads with an expired sleep ready.  Handler of TRU_THREAD_SGI and the global timer IRQ
+static void tru_thread_timer_isr(void){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	tru_thread_t *t;
+	uint64_t now;
+
+	tru_spin_lock(&rq->lock);
+	gtim_disarm_compare();
+	gtim_clear_event();
+
+	now = gtim_get_counter();
+	while(rq->sleepers != NULL && rq->sleepers->wake <= now){
+		t = rq->sleepers;
+		rq->sleepers = t->next;
+		t->state = TRU_THREAD_READY;
+		tru_thread_push_tail(rq, t);
+	}
+	if(rq->sleepers != NULL) tru_thread_arm(rq);
+	tru_spin_unlock(&rq->lock);
+}
+
+// Gets the given CPU to switch to its highest priority ready thread
+static void tru_thread_resched(uint32_t cpu){
+	uint32_t self = tru_cpu_id();
+
+	if(cpu != self){
+		tru_ipi_send(TRU_THREAD_SGI, 1UL << cpu);
+	}else if(tru_thread_rqs[self].in_irq){
+		// The end of IRQ_Handler switches
+	}else if(__get_CPSR() & TRU_THREAD_CPSR_I){
+		tru_ipi_send_self(TRU_THREAD_SGI);  // Switches when the IRQ is unmasked
+	}else{
+		__ASM volatile("SVC    #0" ::: "memory");
+	}
+}
+
+// Makes a blocked thread ready, and preempts the thread running on its CPU if it has a lower priority
+static void tru_thread_wake(tru_thread_t *t){
+	tru_thread_rq_t *rq = &tru_thread_rqs[t->cpu];
+	bool preempt = false;
+	uint32_t flags;
+
+	flags = tru_spin_lock_irqsave(&rq->lock);
+	if(t->state == TRU_THREAD_BLOCKED){
+		t->state = TRU_THREAD_READY;
+		tru_thread_push_tail(rq, t);
+		preempt = rq->current != NULL && t->prio > rq->current->prio;
+	}
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	if(preempt) tru_thread_resched(t->cpu);
+}
+
+// ========
+// Lazy VFP
+// ========
+
+#if TRU_THREAD_VFP == 1U
+static inline void tru_thread_vfp_save(tru_thread_vfp_t *vfp){
+	uint64_t *d = vfp->d;
+
+	vfp->fpscr = __get_FPSCR();
+	__ASM volatile(
+		"VSTMIA %0!, {d0-d15}                 \n"
+		"VSTMIA %0!, {d16-d31}                \n"
+		: "+r" (d) : : "memory"
+	);
+}
+
+static inline void tru_thread_vfp_load(tru_thread_vfp_t *vfp){
+	uint64_t *d = vfp->d;
+
+	__ASM volatile(
+		"VLDMIA %0!, {d0-d15}                 \n"
+		"VLDMIA %0!, {d16-d31}                \n"
+		: "+r" (d) : : "memory"
+	);
+	__set_FPSCR(vfp->fpscr);
+}
+
+/*
+	Called by Undef_Handler.  A VFP/NEON instruction of a thread that does
+	not own the VFP registers: saves them for the owner and loads the
+	registers of the thread.  Returns 1 if handled, or 0 if it is not a lazy
+	VFP trap.
+*/
+uint32_t tru_thread_vfp_trap(void){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	uint32_t fpexc = __get_FPEXC();
+
+	if((fpexc & TRU_THREAD_FPEXC_EN) || rq->current == NULL) return 0U;
+
+	__set_FPEXC(fpexc | TRU_THREAD_FPEXC_EN);
+	if(rq->vfp_owner != NULL) tru_thread_vfp_save(&rq->vfp_owner->vfp);
+	tru_thread_vfp_load(&rq->current->vfp);
+	rq->vfp_owner = rq->current;
+
+	return 1U;
+}
+
+// Overrides the startup default handler
+__attribute__((naked)) void Undef_Handler(void){
+	__ASM volatile(
+		"PUSH   {r0-r3, r12, lr}              \n"
+		"BL     tru_thread_vfp_trap           \n"
+		"CMP    r0, #0                        \n"
+		"POP    {r0-r3, r12, lr}              \n"  // Does not change the flags
+		"BEQ    Default_Handler               \n"  // Not a lazy VFP trap
+		"PUSH   {r0}                          \n"
+		"MRS    r0, spsr                      \n"
+		"TST    r0, #0x20                     \n"  // Thumb state?
+		"POP    {r0}                          \n"
+		"SUBNE  lr, lr, #2                    \n"
+		"SUBEQ  lr, lr, #4                    \n"
+		"MOVS   pc, lr                        \n"  // Return to the trapped instruction
+	);
+}
+#endif
+
+// ==============
+// Context switch
+// ==============
+
+/*
+	Called on the way out of IRQ_Handler and SVC_Handler, with the IRQ
+	masked and the frame of the running thread on its stack.  Returns the
+	frame to restore, the same one if the running thread carries on.  Must
+	not use the VFP, the registers may belong to another thread.
+*/
+uint32_t *tru_thread_schedule(uint32_t *frame){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	tru_thread_t *cur = rq->current;
+	tru_thread_t *next;
+	uint32_t bitmap;
+
+	if(cur == NULL) return frame;  // Not running threads on this CPU
+
+	// Fast path without the lock.  Only this CPU changes the state of a running thread, and a wake up from the other CPU
+	// that is missed here sends TRU_THREAD_SGI after it
+	bitmap = rq->bitmap;
+	if(cur->state == TRU_THREAD_RUNNING && (bitmap == 0U || 31U - __CLZ(bitmap) <= cur->prio)) return frame;
+
+	tru_spin_lock(&rq->lock);
+	if(cur->state == TRU_THREAD_RUNNING){
+		bitmap = rq->bitmap;
+		if(bitmap == 0U || 31U - __CLZ(bitmap) <= cur->prio){
+			tru_spin_unlock(&rq->lock);
+			return frame;
+		}
+		cur->state = TRU_THREAD_READY;
+		tru_thread_push_head(rq, cur);  // Preempted, first in line at its priority
+	}
+	cur->sp = frame;
+	next = tru_thread_pop_highest(rq);
+	next->state = TRU_THREAD_RUNNING;
+	rq->current = next;
+	tru_spin_unlock(&rq->lock);
+
+#if TRU_THREAD_VFP == 1U
+	uint32_t fpexc = __get_FPEXC();
+	__set_FPEXC(next == rq->vfp_owner ? fpexc | TRU_THREAD_FPEXC_EN : fpexc & ~TRU_THREAD_FPEXC_EN);
+#endif
+
+	return next->sp;
+}
+
+void tru_thread_irq_dispatch(IRQn_ID_t irq_id){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+
+	rq->in_irq = 1U;
+	irq_dispatch_id(irq_id);
+	rq->in_irq = 0U;
+}
+
+// Disable: warning: FP registers might be clobbered despite 'interrupt' attribute, the handlers below save them
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattributes"
+
+// Overrride CMSIS default weak prototype (see irq_ctrl_gic.h).  The frame goes on the stack of the interrupted thread
+__attribute__((naked)) void IRQ_Handler(void){
+	__ASM volatile(
+		"SUB    lr, lr, #4                    \n"  // Return address
+		"SRSDB  sp!, #0x1F                    \n"  // Push LR_irq and SPSR_irq onto the SYS mode stack
+		"CPS    #0x1F                         \n"  // Switch to SYS mode, the IRQ stays masked
+		"PUSH   {r0-r12, lr}                  \n"  // The rest of the frame
+		"MOV    r4, sp                        \n"
+		"AND    r4, r4, #4                    \n"
+		"SUB    sp, sp, r4                    \n"  // Align SP to 8 bytes as required by the AAPCS
+#if TRU_THREAD_VFP == 1U
+		"VMRS   r0, fpexc                     \n"
+		"ORR    r1, r0, #0x40000000           \n"
+		"VMSR   fpexc, r1                     \n"  // The handlers may use the VFP, whichever thread owns it
+		"VMRS   r1, fpscr                     \n"
+		"PUSH   {r0, r1}                      \n"  // Push FPEXC and FP status value
+		"VSTMDB sp!, {d0-d15}                 \n"  // Push d0-d15 VFP registers
+		"VSTMDB sp!, {d16-d31}                \n"  // Push d16-d31 VFP registers
+#endif
+		"BL     IRQ_GetActiveIRQ              \n"
+		"MOV    r5, r0                        \n"
+		"BL     tru_thread_irq_dispatch       \n"
+		"MOV    r0, r5                        \n"
+		"BL     IRQ_EndOfInterrupt            \n"  // Set interrupt is serviced
+#if TRU_THREAD_VFP == 1U
+		"VLDMIA sp!, {d16-d31}                \n"  // Pop into d16-d31 registers
+		"VLDMIA sp!, {d0-d15}                 \n"  // Pop into d0-d15 registers
+		"POP    {r0, r1}                      \n"
+		"VMSR   fpscr, r1                     \n"
+		"VMSR   fpexc, r0                     \n"
+#endif
+		"ADD    r0, sp, r4                    \n"  // Frame of the interrupted thread
+		"BL     tru_thread_schedule           \n"
+		"MOV    sp, r0                        \n"  // Frame of the thread to run
+		"CLREX                                \n"  // Clear the local exclusive monitor, an interrupted LDREX/STREX sequence retries
+		"POP    {r0-r12, lr}                  \n"
+		"RFEIA  sp!                           \n"  // Return to the thread, restoring its CPSR
+	);
+}
+
+// Overrides the startup default handler.  Every SVC is a reschedule request from a thread
+__attribute__((naked)) void SVC_Handler(void){
+	__ASM volatile(
+		"SRSDB  sp!, #0x1F                    \n"  // Push LR_svc (the instruction after the SVC) and SPSR_svc onto the SYS mode stack
+		"CPS    #0x1F                         \n"
+		"PUSH   {r0-r12, lr}                  \n"
+		"MOV    r0, sp                        \n"
+		"MOV    r4, sp                        \n"
+		"AND    r4, r4, #4                    \n"
+		"SUB    sp, sp, r4                    \n"  // Align SP to 8 bytes as required by the AAPCS
+		"BL     tru_thread_schedule           \n"
+		"MOV    sp, r0                        \n"
+		"CLREX                                \n"
+		"POP    {r0-r12, lr}                  \n"
+		"RFEIA  sp!                           \n"
+	);
+}
+
+#pragma GCC diagnostic pop
+
+// ===
+// API
+// ===
+
+/*
+	Creates a thread on the given CPU, it is ready to run straight away.
+	The caller provides the tru_thread_t and the stack, which must stay
+	valid until the thread exits.  Returning from fn exits the thread.
+	Returns 0 on success, -1 on invalid arguments.
+*/
+int tru_thread_create(tru_thread_t *t, uint32_t cpu, uint32_t prio, tru_thread_fn_t fn, void *ctx, void *stack, uint32_t stack_size){
+	tru_thread_rq_t *rq;
+	uint32_t *sp;
+	uint32_t flags;
+
+	if(t == NULL || fn == NULL || stack == NULL || cpu >= TRU_THREAD_CPUS || prio == 0U || prio >= TRU_THREAD_PRIOS || stack_size < TRU_THREAD_STACK_MIN) return -1;
+
+	// Initial frame, restored by the first switch to the thread
+	sp = (uint32_t *)(((uint32_t)stack + stack_size) & ~7UL);
+	sp -= TRU_THREAD_FRAME_WORDS;
+	for(uint32_t i = 1U; i < 13U; i++) sp[i] = 0U;
+	sp[0] = (uint32_t)ctx;                // r0
+	sp[13] = (uint32_t)tru_thread_exit;   // lr
+	sp[14] = (uint32_t)fn & ~1UL;         // pc
+	sp[15] = TRU_THREAD_CPSR_SYS | (((uint32_t)fn & 1UL) ? TRU_THREAD_CPSR_T : 0U);
+
+	t->sp = sp;
+	t->next = NULL;
+	t->prio = prio;
+	t->cpu = cpu;
+	t->state = TRU_THREAD_BLOCKED;
+	t->wake = 0U;
+#if TRU_THREAD_VFP == 1U
+	memset(&t->vfp, 0, sizeof(t->vfp));
+#endif
+
+	rq = &tru_thread_rqs[cpu];
+	flags = tru_spin_lock_irqsave(&rq->lock);
+	rq->alive++;
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	tru_thread_wake(t);
+
+	return 0;
+}
+
+/*
+	Runs the threads of the calling CPU, which becomes its idle thread.
+	Returns when all of them have exited.
+*/
+void tru_thread_run(void){
+	uint32_t cpu = tru_cpu_id();
+	tru_thread_rq_t *rq = &tru_thread_rqs[cpu];
+	tru_thread_t *idle = &rq->idle;
+	uint32_t flags;
+
+	tru_time_ensure_started();
+
+	// The SGI and the timer have the lowest priority, so the switch waits for the other handlers
+	IRQ_SetPriority(TRU_THREAD_SGI, GIC_IRQ_PRIORITY_GRP5SUB3_LOWEST);
+	IRQ_SetPriority(TRU_THREAD_GTIM_IRQ, GIC_IRQ_PRIORITY_GRP5SUB3_LOWEST);
+	tru_ipi_set_handler(TRU_THREAD_SGI, tru_thread_timer_isr);
+	IRQ_SetHandler(TRU_THREAD_GTIM_IRQ, tru_thread_timer_isr);
+	tru_ipi_enable(TRU_THREAD_SGI);
+	IRQ_Enable(TRU_THREAD_GTIM_IRQ);
+
+	flags = tru_spin_lock_irqsave(&rq->lock);
+	idle->next = NULL;
+	idle->prio = 0U;
+	idle->cpu = cpu;
+	idle->state = TRU_THREAD_RUNNING;
+	rq->current = idle;
+#if TRU_THREAD_VFP == 1U
+	rq->vfp_owner = idle;  // The VFP registers of the caller are live
+#endif
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	// Switch to the threads, the idle thread only runs when none of them is ready
+	tru_thread_resched(cpu);
+	while(rq->alive){
+		__DSB();
+		__WFI();
+	}
+
+	flags = tru_spin_lock_irqsave(&rq->lock);
+#if TRU_THREAD_VFP == 1U
+	// Get the VFP registers of the caller back, the exited threads no longer own them
+	__set_FPEXC(__get_FPEXC() | TRU_THREAD_FPEXC_EN);
+	if(rq->vfp_owner != idle) tru_thread_vfp_load(&idle->vfp);
+	rq->vfp_owner = NULL;
+#endif
+	rq->current = NULL;
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	IRQ_Disable(TRU_THREAD_GTIM_IRQ);
+	tru_ipi_disable(TRU_THREAD_SGI);
+	gtim_disarm_compare();
+}
+
+tru_thread_t *tru_thread_self(void){
+	return tru_thread_rqs[tru_cpu_id()].current;
+}
+
+// Lets the other ready threads of the same priority run first
+void tru_thread_yield(void){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	tru_thread_t *cur = rq->current;
+	uint32_t flags;
+
+	flags = tru_spin_lock_irqsave(&rq->lock);
+	if(cur->state == TRU_THREAD_RUNNING){
+		cur->state = TRU_THREAD_READY;
+		tru_thread_push_tail(rq, cur);
+	}
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	__ASM volatile("SVC    #0" ::: "memory");
+}
+
+// Sleeps for a number of global timer ticks, see tru_time_us_to_ticks() and tru_time_ms_to_ticks()
+void tru_thread_sleep(uint64_t ticks){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	tru_thread_t *cur = rq->current;
+	tru_thread_t **link;
+	uint32_t flags;
+
+	if(ticks == 0U){
+		tru_thread_yield();
+		return;
+	}
+
+	flags = tru_spin_lock_irqsave(&rq->lock);
+	cur->wake = gtim_get_counter() + ticks;
+	cur->state = TRU_THREAD_SLEEPING;
+
+	// Insert in wake time order, after the ones with the same time
+	link = &rq->sleepers;
+	while(*link != NULL && (*link)->wake <= cur->wake) link = &(*link)->next;
+	cur->next = *link;
+	*link = cur;
+
+	if(rq->sleepers == cur) tru_thread_arm(rq);
+	tru_spin_unlock_irqrestore(&rq->lock, flags);
+
+	__ASM volatile("SVC    #0" ::: "memory");
+}
+
+// Ends the calling thread, also called when the thread function returns
+void tru_thread_exit(void){
+	tru_thread_rq_t *rq = &tru_thread_rqs[tru_cpu_id()];
+	tru_thread_t *cur = rq->current;
+
+	tru_spin_lock_irqsave(&rq->lock);
+	cur->state = TRU_THREAD_DEAD;
+	rq->alive--;
+#if TRU_THREAD_VFP == 1U
+	if(rq->vfp_owner == cur) rq->vfp_owner = NULL;
+#endif
+	tru_spin_unlock(&rq->lock);  // Keep the IRQ masked, the SVC switches away for good
+
+	__ASM volatile("SVC    #0" ::: "memory");
+	while(1);
+}
+
+// ==========
+// Semaphores
+// ==========
+
+void tru_thread_sem_init(tru_thread_sem_t *sem, uint32_t count){
+	tru_spin_init(&sem->lock);
+	sem->count = count;
+	sem->head = NULL;
+	sem->tail = NULL;
+}
+
+// Takes one count, blocks while there is none.  Only from a thread
+void tru_thread_sem_wait(tru_thread_sem_t *sem){
+	tru_thread_t *cur = tru_thread_self();
+	uint32_t flags;
+
+	flags = tru_spin_lock_irqsave(&sem->lock);
+	if(sem->count){
+		sem->count--;
+		tru_spin_unlock_irqrestore(&sem->lock, flags);
+		return;
+	}
+
+	// Blocked before it is visible to a post, which makes it ready again under the run queue lock
+	cur->state = TRU_THREAD_BLOCKED;
+	cur->next = NULL;
+	if(sem->head == NULL){
+		sem->head = cur;
+	}else{
+		sem->tail->next = cur;
+	}
+	sem->tail = cur;
+	tru_spin_unlock_irqrestore(&sem->lock, flags);
+
+	__ASM volatile("SVC    #0" ::: "memory");
+}
+
+// Gives one count, or wakes the oldest waiter.  From a thread, an IRQ handler or the other CPU
+void tru_thread_sem_post(tru_thread_sem_t *sem){
+	tru_thread_t *t;
+	uint32_t flags;
+
+	flags = tru_spin_lock_irqsave(&sem->lock);
+	t = sem->head;
+	if(t != NULL){
+		sem->head = t->next;
+		if(sem->head == NULL) sem->tail = NULL;
+	}else{
+		sem->count++;
+	}
+	tru_spin_unlock_irqrestore(&sem->lock, flags);
+
+	if(t != NULL) tru_thread_wake(t);
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Minimal preemptive kernel: fixed priority threads with a run queue per
+	CPU.
+
+	Enabled with TRU_THREAD == 1U (see tru_user_config.h), which makes the
+	CMSIS IRQ_Handler weak (see tru_config.h).  This file then supplies
+	IRQ_Handler, SVC_Handler and Undef_Handler.  The threads run in SYS mode
+	on their own stacks, the startup (startup_c5soc.c) mode stacks are only
+	used by the FIQ and abort handlers, and by the undefined instruction
+	handler for the VFP trap.
+
+	Scheduling:
+		- Priority 1 (lowest) to 31, 0 is the idle thread, which is the
+		  caller of tru_thread_run().  The highest priority ready thread runs,
+		  threads of equal priority run in FIFO order and only give up the
+		  CPU with tru_thread_yield() or by blocking (no time slicing)
+		- A ready bitmap per CPU, the next thread is found with CLZ (O(1))
+		- A thread stays on the CPU it was created for, each CPU has its own
+		  run queue and lock.  Only a wake up from the other CPU takes the
+		  lock of a remote queue
+
+	Context switch:
+		A switch only happens on the way out of an exception, which saves the
+		integer registers and the return state as a frame on the stack of
+		the thread, so switching is storing and loading the frame pointer.
+		- Blocking calls switch with SVC
+		- A wake up from an IRQ handler switches at the end of IRQ_Handler
+		- A wake up of a higher priority thread on the other CPU sends it
+		  TRU_THREAD_SGI, the lowest priority interrupt (like PendSV on the
+		  Cortex-M), so the switch happens when its other handlers are done
+
+	Lazy VFP:
+		The VFP registers belong to one thread per CPU at a time.  A switch
+		to any other thread clears FPEXC.EN, its first VFP/NEON instruction
+		traps to Undef_Handler, which saves the registers of the previous
+		owner into its tru_thread_t, loads its own and re-executes the
+		instruction.  Threads that never use the VFP never pay for it.
+		IRQ_Handler saves and restores the VFP registers around the handlers
+		as without the kernel.
+
+	Tickless sleep:
+		There is no periodic tick.  The global timer comparator (banked per
+		CPU) is armed for the earliest sleeper of the CPU, the idle thread
+		waits with WFI.
+
+	Usage, on each CPU that runs threads:
+		tru_thread_create(&t, tru_cpu_id(), 5U, fn, ctx, stack, sizeof(stack));
+		tru_thread_run();  // Returns when all threads of this CPU have exited
+
+	Notes:
+		- The kernel owns the global timer comparator and its IRQ on the CPUs
+		  running tru_thread_run(), tru_co cannot run there
+		- Every SVC is a reschedule, a semihosting SVC is trapped by the
+		  debugger before it reaches the vector
+		- A thread stack needs at least TRU_THREAD_STACK_MIN bytes on top of
+		  its own use, for the IRQ frame and the handlers
+		- The blocking calls must not be called from an IRQ handler, the
+		  post and create calls can be
+*/
+
+#ifndef TRU_THREAD_H
+#define TRU_THREAD_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_THREAD) && TRU_THREAD == 1U
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "arm/tru_cortex_a9.h"
+#include "arm/tru_lock.h"
+#include "tru_time.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
+	#define TRU_THREAD_VFP 1U
+#else
+	#define TRU_THREAD_VFP 0U
+#endif
+
+#define TRU_THREAD_CPUS      2U
+#define TRU_THREAD_PRIOS     32U
+#define TRU_THREAD_SGI       SGI12_IRQn
+#define TRU_THREAD_GTIM_IRQ  VirtualTimer_IRQn  // Cortex-A9 global timer PPI
+#define TRU_THREAD_STACK_MIN 1024U              // IRQ frame with the VFP registers, plus the handlers
+
+// Thread states
+#define TRU_THREAD_READY    0U  // In the run queue
+#define TRU_THREAD_RUNNING  1U
+#define TRU_THREAD_BLOCKED  2U  // Waiting on a semaphore, or created and not started yet
+#define TRU_THREAD_SLEEPING 3U
+#define TRU_THREAD_DEAD     4U
+
+typedef void (*tru_thread_fn_t)(void *ctx);
+
+typedef struct{
+	uint32_t fpscr;
+	uint32_t res;
+	uint64_t d[32];
+}tru_thread_vfp_t;
+
+typedef struct tru_thread tru_thread_t;
+
+struct tru_thread{
+	uint32_t *sp;           // Saved exception frame: r0-r12, lr, pc, cpsr
+	tru_thread_t *next;     // Run queue, sleep list or semaphore wait list
+	uint32_t prio;
+	uint32_t cpu;
+	volatile uint32_t state;
+	uint64_t wake;          // Global timer count to wake up at
+#if TRU_THREAD_VFP == 1U
+	tru_thread_vfp_t vfp;   // VFP registers while another thread owns them
+#endif
+};
+
+// Counting semaphore, a post wakes the oldest waiter
+typedef struct{
+	tru_spinlock_t lock;
+	uint32_t count;
+	tru_thread_t *head;
+	tru_thread_t *tail;
+}tru_thread_sem_t;
+
+int tru_thread_create(tru_thread_t *t, uint32_t cpu, uint32_t prio, tru_thread_fn_t fn, void *ctx, void *stack, uint32_t stack_size);
+void tru_thread_run(void);
+tru_thread_t *tru_thread_self(void);
+void tru_thread_yield(void);
+void tru_thread_sleep(uint64_t ticks);
+void tru_thread_exit(void);
+
+void tru_thread_sem_init(tru_thread_sem_t *sem, uint32_t count);
+void tru_thread_sem_wait(tru_thread_sem_t *sem);
+void tru_thread_sem_post(tru_thread_sem_t *sem);
+
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	High resolution time from the Cortex-A9 global timer.
+*/
+
+#include "tru_time.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#define TRU_TIME_CAL_RUNS 8U
+
+tru_time_clock_t tru_time_clock;
+
+/*
+	Sets up the conversion from a from_hz rate to a to_hz rate with the
+	largest shift, up to 32, that keeps the multiplier in 32 bits.
+*/
+void tru_time_conv_init(tru_time_conv_t *conv, uint32_t from_hz, uint32_t to_hz){
+	uint32_t shift = 32U;
+
+	while(shift > 0U && (((uint64_t)to_hz << shift) + from_hz / 2U) / from_hz > 0xFFFFFFFFU) shift--;
+	conv->shift = shift;
+	conv->mult = (uint32_t)((((uint64_t)to_hz << shift) + from_hz / 2U) / from_hz);
+}
+
+/*
+	Reads the processor clock and sets up the conversions, then measures the
+	fixed cost of a busy wait call.  Starts the global timer if it is not
+	running.
+*/
+void tru_time_init(void){
+	tru_time_clock_t *c = &tru_time_clock;
+	uint32_t best = 0xFFFFFFFFU;
+
+	tru_time_ensure_started();
+
+	SystemCoreClockUpdate();
+	c->cpu_hz = SystemCoreClock;
+	c->hz = SystemCoreClock / 4U;
+	tru_time_conv_init(&c->t2ns, c->hz, 1000000000U);
+	tru_time_conv_init(&c->ns2t, 1000000000U, c->hz);
+	tru_time_conv_init(&c->t2us, c->hz, 1000000U);
+	tru_time_conv_init(&c->us2t, 1000000U, c->hz);
+	tru_time_conv_init(&c->c2ns, c->cpu_hz, 1000000000U);
+
+	// The shortest of a few zero waits, the first ones warm up the caches
+	c->delay_adj = 0U;
+	for(uint32_t i = 0U; i < TRU_TIME_CAL_RUNS; i++){
+		uint32_t t0 = GTIM_REG->counterl;
+		tru_time_delay_ticks(0U);
+		uint32_t t = GTIM_REG->counterl - t0;
+		if(t < best) best = t;
+	}
+	c->delay_adj = best;
+}
+
+#endif
@@ -0,0 +1,214 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	High resolution time from the Cortex-A9 global timer.
+
+	The global timer counts at 1/4 of the processor clock, 5 ns per tick at
+	800 MHz.  tru_time_init() reads the processor clock (SystemCoreClock after
+	SystemCoreClockUpdate()) and precomputes fixed point multipliers for the
+	conversions between ticks, ns, us and PMU cycles, so a conversion is a
+	multiply and a shift, never a division:
+		out = (in * mult) >> shift
+	The shift is the largest that keeps mult in 32 bits, up to 32, so the
+	relative error is below 1e-9 for every conversion except ticks to us
+	(below 1e-7).  A 64 bit input is split into two 32 x 32 multiplies.
+
+	tru_time_init() is called by tru_bsp_init(), so it is ready in main(),
+	and again by tru_hps_clkmgr_set_mpu_hz() when the MPU clock changes.
+
+	Busy waits poll the lower 32 bits of the counter, one device read per
+	loop, and subtract the fixed cost of a call measured by tru_time_init().
+	They are accurate to a few ticks when the IRQs are masked.
+
+	Usage:
+		uint64_t t0 = tru_time_now_ticks();
+		...
+		printf("%lu ns\n", (unsigned long)tru_time_ticks_to_ns(tru_time_now_ticks() - t0));
+
+		uint64_t deadline = tru_time_deadline_us(100U);
+		while(!ready()){
+			if(tru_time_expired(deadline)) return -1;  // Timeout
+		}
+*/
+
+#ifndef TRU_TIME_H
+#define TRU_TIME_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "arm/tru_cortex_a9.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct{
+	uint32_t mult;
+	uint32_t shift;
+}tru_time_conv_t;
+
+typedef struct{
+	uint32_t cpu_hz;          // Processor clock, the PMU cycle counter rate
+	uint32_t hz;              // Global timer clock
+	uint32_t delay_adj;       // Fixed cost of a busy wait call, ticks
+	tru_time_conv_t t2ns;     // Ticks to ns
+	tru_time_conv_t ns2t;     // ns to ticks
+	tru_time_conv_t t2us;     // Ticks to us
+	tru_time_conv_t us2t;     // us to ticks
+	tru_time_conv_t c2ns;     // PMU cycles to ns
+}tru_time_clock_t;
+
+extern tru_time_clock_t tru_time_clock;
+
+void tru_time_init(void);
+void tru_time_conv_init(tru_time_conv_t *conv, uint32_t from_hz, uint32_t to_hz);
+
+// Starts the global timer from 0 if it is not running.  Its counter is shared by every user, so it is never restarted
+static inline void tru_time_ensure_started(void){
+	if(!GTIM_REG->control.bits.enable){
+		gtim_setup_basic_mode();
+		gtim_zero_counter();
+		gtim_enable();
+	}
+}
+
+// Converts a 64 bit value.  The result is exact to within the mult rounding, it is valid while it fits in 64 bits
+static inline uint64_t tru_time_conv(const tru_time_conv_t *conv, uint64_t in){
+	uint32_t hi = (uint32_t)(in >> 32U);
+	uint32_t lo = (uint32_t)in;
+
+	return (((uint64_t)hi * conv->mult) << (32U - conv->shift)) + (((uint64_t)lo * conv->mult) >> conv->shift);
+}
+
+// Converts a 32 bit value, a single multiply
+static inline uint64_t tru_time_conv32(const tru_time_conv_t *conv, uint32_t in){
+	return ((uint64_t)in * conv->mult) >> conv->shift;
+}
+
+// ==============
+// Time and units
+// ==============
+
+static inline uint64_t tru_time_now_ticks(void){
+	return gtim_get_counter();
+}
+
+static inline uint64_t tru_time_now_ns(void){
+	return tru_time_conv(&tru_time_clock.t2ns, gtim_get_counter());
+}
+
+static inline uint64_t tru_time_now_us(void){
+	return tru_time_conv(&tru_time_clock.t2us, gtim_get_counter());
+}
+
+static inline uint64_t tru_time_ticks_to_ns(uint64_t ticks){
+	return tru_time_conv(&tru_time_clock.t2ns, ticks);
+}
+
+static inline uint64_t tru_time_ticks_to_us(uint64_t ticks){
+	return tru_time_conv(&tru_time_clock.t2us, ticks);
+}
+
+static inline uint64_t tru_time_ns_to_ticks(uint64_t ns){
+	return tru_time_conv(&tru_time_clock.ns2t, ns);
+}
+
+static inline uint64_t tru_time_us_to_ticks(uint64_t us){
+	return tru_time_conv(&tru_time_clock.us2t, us);
+}
+
+static inline uint64_t tru_time_ms_to_ticks(uint32_t ms){
+	return tru_time_conv(&tru_time_clock.us2t, (uint64_t)ms * 1000U);
+}
+
+// Converts a PMU cycle count (tru_pmu_ccnt() difference) to ns
+static inline uint64_t tru_time_cycles_to_ns(uint32_t cycles){
+	return tru_time_conv32(&tru_time_clock.c2ns, cycles);
+}
+
+// ======================
+// Deadlines and timeouts
+// ======================
+
+static inline uint64_t tru_time_deadline_ticks(uint64_t ticks){
+	return gtim_get_counter() + ticks;
+}
+
+static inline uint64_t tru_time_deadline_ns(uint32_t ns){
+	return gtim_get_counter() + tru_time_conv32(&tru_time_clock.ns2t, ns);
+}
+
+static inline uint64_t tru_time_deadline_us(uint32_t us){
+	return gtim_get_counter() + tru_time_conv32(&tru_time_clock.us2t, us);
+}
+
+static inline uint64_t tru_time_deadline_ms(uint32_t ms){
+	return gtim_get_counter() + tru_time_ms_to_ticks(ms);
+}
+
+static inline bool tru_time_expired(uint64_t deadline){
+	return gtim_get_counter() >= deadline;
+}
+
+// Returns the ticks left until the deadline, 0 if it has passed
+static inline uint64_t tru_time_remaining(uint64_t deadline){
+	uint64_t now = gtim_get_counter();
+
+	return (now < deadline) ? deadline - now : 0U;
+}
+
+// ==========
+// Busy waits
+// ==========
+
+// Waits for ticks global timer ticks, from the call to the return
+static inline void tru_time_delay_ticks(uint64_t ticks){
+	uint32_t start = GTIM_REG->counterl;
+
+	ticks = (ticks > tru_time_clock.delay_adj) ? ticks - tru_time_clock.delay_adj : 0U;
+	while(ticks > 0xFFFFFFFFU){
+		// Long wait, in steps that the 32 bit difference cannot wrap in
+		while((uint32_t)(GTIM_REG->counterl - start) < 0x80000000U);
+		start += 0x80000000U;
+		ticks -= 0x80000000U;
+	}
+	while((uint32_t)(GTIM_REG->counterl - start) < (uint32_t)ticks);
+}
+
+static inline void tru_time_delay_ns(uint32_t ns){
+	tru_time_delay_ticks(tru_time_conv32(&tru_time_clock.ns2t, ns));
+}
+
+static inline void tru_time_delay_us(uint32_t us){
+	tru_time_delay_ticks(tru_time_conv32(&tru_time_clock.us2t, us));
+}
+
+static inline void tru_time_delay_ms(uint32_t ms){
+	tru_time_delay_ticks(tru_time_ms_to_ticks(ms));
+}
+
+#endif
+
+#endif
@@ -0,0 +1,363 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Hierarchical software timer wheel driven by the global timer comparator.
+*/
+
+#include "tru_timer.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_defer.h"
+#include "tru_cache.h"
+
+#define TRU_TIMER_RES      (1ULL << TRU_TIMER_RES_SHIFT)
+#define TRU_TIMER_DETACHED TRU_TIMER_LEVELS  // Level of a timer taken off the wheel for expiry
+#define TRU_TIMER_RANGE    (1ULL << (TRU_TIMER_LEVELS * TRU_TIMER_SLOT_BITS))  // Wheel ticks covered by the top level
+#define TRU_TIMER_NONE     UINT64_MAX
+#define TRU_TIMER_MARGIN   64U  // Global timer ticks, for arming the comparator when the event is already due
+
+typedef struct{
+	tru_timer_t *slots[TRU_TIMER_LEVELS][TRU_TIMER_SLOTS];
+	uint64_t bitmap[TRU_TIMER_LEVELS];  // Non-empty slots
+	uint64_t next;                      // First wheel tick not processed yet
+	uint64_t armed;                     // Wheel tick the comparator is armed for
+	tru_timer_stats_t stats;
+}__attribute__((aligned(CACHELINE_SIZE))) tru_timer_cpu_t;
+
+static tru_timer_cpu_t tru_timer_cpus[TRU_TIMER_CPUS];
+
+static inline uint32_t tru_timer_irq_save(void){
+	uint32_t flags = __get_CPSR() & CPSR_I_Msk;
+
+	__disable_irq();
+	return flags;
+}
+
+static inline void tru_timer_irq_restore(uint32_t flags){
+	if(!flags) __enable_irq();
+}
+
+static inline uint32_t tru_timer_shift(uint32_t level){
+	return level * TRU_TIMER_SLOT_BITS;
+}
+
+static inline uint64_t tru_timer_ror64(uint64_t x, uint32_t n){
+	return n ? (x >> n) | (x << (64U - n)) : x;
+}
+
+// ====================
+// Wheel list and slots
+// ====================
+
+static void tru_timer_unlink(tru_timer_cpu_t *c, tru_timer_t *t){
+	*t->pprev = t->next;
+	if(t->next != NULL) t->next->pprev = t->pprev;
+	if(t->level != TRU_TIMER_DETACHED && c->slots[t->level][t->slot] == NULL){
+		c->bitmap[t->level] &= ~(1ULL << t->slot);
+	}
+	t->pprev = NULL;
+}
+
+/*
+	Puts a timer into the level its remaining time fits in.  The slot of an
+	upper level is never the one the wheel is in, so it is always reached and
+	cascaded before the timer is due.  Returns the wheel tick of the slot.
+*/
+static uint64_t tru_timer_insert(tru_timer_cpu_t *c, tru_timer_t *t){
+	uint64_t w = (t->expires + TRU_TIMER_RES - 1U) >> TRU_TIMER_RES_SHIFT;  // Round up, never early
+	uint64_t delta;
+	uint32_t level = 0U;
+	tru_timer_t **head;
+
+	if(w < c->next) w = c->next;
+	delta = w - c->next;
+	if(delta >= TRU_TIMER_RANGE){
+		w = c->next + TRU_TIMER_RANGE - 1U;  // Waits in the top level and cascades again
+		delta = TRU_TIMER_RANGE - 1U;
+	}
+	while(delta >= (1ULL << tru_timer_shift(level + 1U))) level++;
+
+	t->level = (uint8_t)level;
+	t->slot = (uint8_t)((w >> tru_timer_shift(level)) & (TRU_TIMER_SLOTS - 1U));
+	head = &c->slots[level][t->slot];
+	t->next = *head;
+	if(t->next != NULL) t->next->pprev = &t->next;
+	t->pprev = head;
+	*head = t;
+	c->bitmap[level] |= 1ULL << t->slot;
+
+	return (w >> tru_timer_shift(level)) << tru_timer_shift(level);
+}
+
+// Returns the nearest wheel tick with an expiry or a cascade, or TRU_TIMER_NONE
+static uint64_t tru_timer_next_event(const tru_timer_cpu_t *c){
+	uint64_t best = TRU_TIMER_NONE;
+
+	for(uint32_t level = 0U; level < TRU_TIMER_LEVELS; level++){
+		if(c->bitmap[level]){
+			uint32_t shift = tru_timer_shift(level);
+			uint64_t q = (c->next + (1ULL << shift) - 1U) >> shift;  // First slot at or after next
+			uint32_t s = (uint32_t)q & (TRU_TIMER_SLOTS - 1U);
+			uint64_t t = (q + (uint64_t)__builtin_ctzll(tru_timer_ror64(c->bitmap[level], s))) << shift;
+
+			if(t < best) best = t;
+		}
+	}
+
+	return best;
+}
+
+// Moves the timers of an upper level slot down to the levels below
+static void tru_timer_cascade(tru_timer_cpu_t *c, uint32_t level, uint32_t slot){
+	tru_timer_t *t = c->slots[level][slot];
+
+	c->slots[level][slot] = NULL;
+	c->bitmap[level] &= ~(1ULL << slot);
+	while(t != NULL){
+		tru_timer_t *next = t->next;
+
+		tru_timer_insert(c, t);
+		c->stats.cascaded++;
+		t = next;
+	}
+}
+
+// ======
+// Expiry
+// ======
+
+static void tru_timer_defer_run(void *arg){
+	tru_timer_t *t = (tru_timer_t *)arg;
+
+	t->fn(t, t->ctx);
+}
+
+static void tru_timer_expire(tru_timer_cpu_t *c, tru_timer_t *t, uint64_t now){
+	t->fired = t->expires;
+	if(t->period){
+		// Restart before the callback so that it can cancel, skipping the periods already missed
+		t->expires += t->period;
+		if(t->expires <= now) t->expires += ((now - t->expires) / t->period + 1U) * t->period;
+		tru_timer_insert(c, t);
+	}
+
+	c->stats.expired++;
+	if(t->flags & TRU_TIMER_DEFER){
+		if(!tru_defer_post_local(TRU_DEFER_NORMAL, tru_timer_defer_run, t)) c->stats.dropped++;
+	}else{
+		t->fn(t, t->ctx);
+	}
+}
+
+// Runs the wheel up to and including wheel tick target
+static void tru_timer_process(tru_timer_cpu_t *c, uint64_t target, uint64_t now){
+	for(;;){
+		uint64_t t = tru_timer_next_event(c);
+		tru_timer_t *list;
+		uint32_t s;
+
+		if(t > target) break;
+
+		c->next = t;
+		for(uint32_t level = TRU_TIMER_LEVELS - 1U; level > 0U; level--){
+			uint32_t shift = tru_timer_shift(level);
+
+			if((t & ((1ULL << shift) - 1U)) == 0U){
+				tru_timer_cascade(c, level, (uint32_t)(t >> shift) & (TRU_TIMER_SLOTS - 1U));
+			}
+		}
+
+		// Detach the due slot, a callback may cancel or restart any timer in it
+		s = (uint32_t)t & (TRU_TIMER_SLOTS - 1U);
+		list = c->slots[0][s];
+		c->slots[0][s] = NULL;
+		c->bitmap[0] &= ~(1ULL << s);
+		for(tru_timer_t *i = list; i != NULL; i = i->next) i->level = TRU_TIMER_DETACHED;
+		if(list != NULL) list->pprev = &list;
+		c->next = t + 1U;
+
+		while(list != NULL){
+			tru_timer_t *timer = list;
+
+			tru_timer_unlink(c, timer);
+			tru_timer_expire(c, timer, now);
+		}
+	}
+	if(c->next <= target) c->next = target + 1U;
+}
+
+// Arms the comparator for the nearest event, making sure that it is in the future
+static void tru_timer_program(tru_timer_cpu_t *c){
+	uint64_t w = tru_timer_next_event(c);
+	uint64_t at;
+	uint64_t now;
+
+	c->armed = w;
+	if(w == TRU_TIMER_NONE){
+		gtim_disarm_compare();
+		return;
+	}
+
+	at = w << TRU_TIMER_RES_SHIFT;
+	for(;;){
+		gtim_arm_compare(at);
+		now = gtim_get_counter();
+		if(now < at) break;
+		at = now + TRU_TIMER_MARGIN;
+	}
+}
+
+static void tru_timer_isr(void){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+	uint64_t start = gtim_get_counter();
+	uint32_t elapsed;
+
+	gtim_disarm_compare();
+	gtim_clear_event();
+	c->stats.irqs++;
+
+	tru_timer_process(c, start >> TRU_TIMER_RES_SHIFT, start);
+	tru_timer_program(c);
+
+	elapsed = (uint32_t)(gtim_get_counter() - start);
+	c->stats.isr_sum += elapsed;
+	if(elapsed > c->stats.isr_max) c->stats.isr_max = elapsed;
+}
+
+// ===
+// API
+// ===
+
+// Sets up the wheel and the comparator IRQ of the calling CPU
+void tru_timer_cpu_init(void){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+
+	tru_time_ensure_started();
+
+	for(uint32_t level = 0U; level < TRU_TIMER_LEVELS; level++){
+		for(uint32_t slot = 0U; slot < TRU_TIMER_SLOTS; slot++) c->slots[level][slot] = NULL;
+		c->bitmap[level] = 0U;
+	}
+	c->next = gtim_get_counter() >> TRU_TIMER_RES_SHIFT;
+	c->armed = TRU_TIMER_NONE;
+	tru_timer_reset_stats();
+
+	gtim_disarm_compare();
+	gtim_clear_event();
+	IRQ_SetHandler(TRU_TIMER_GTIM_IRQ, tru_timer_isr);
+	IRQ_SetPriority(TRU_TIMER_GTIM_IRQ, TRU_TIMER_PRIORITY);
+	IRQ_Enable(TRU_TIMER_GTIM_IRQ);
+}
+
+void tru_timer_cpu_exit(void){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+
+	IRQ_Disable(TRU_TIMER_GTIM_IRQ);
+	gtim_disarm_compare();
+	gtim_clear_event();
+
+	for(uint32_t level = 0U; level < TRU_TIMER_LEVELS; level++){
+		for(uint32_t slot = 0U; slot < TRU_TIMER_SLOTS; slot++){
+			while(c->slots[level][slot] != NULL) tru_timer_unlink(c, c->slots[level][slot]);
+		}
+	}
+}
+
+void tru_timer_init(tru_timer_t *timer, tru_timer_fn_t fn, void *ctx, uint32_t flags){
+	timer->next = NULL;
+	timer->pprev = NULL;
+	timer->expires = 0U;
+	timer->period = 0U;
+	timer->fired = 0U;
+	timer->fn = fn;
+	timer->ctx = ctx;
+	timer->level = 0U;
+	timer->slot = 0U;
+	timer->flags = (uint8_t)flags;
+}
+
+/*
+	Starts or restarts a timer to expire at the global timer count expires,
+	then every period ticks if period is not 0.  A time in the past expires
+	on the next comparator IRQ.
+*/
+void tru_timer_start_at(tru_timer_t *timer, uint64_t expires, uint64_t period){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+	uint32_t flags = tru_timer_irq_save();
+	uint64_t w;
+
+	if(timer->pprev != NULL) tru_timer_unlink(c, timer);
+	timer->expires = expires;
+	timer->period = period;
+	w = tru_timer_insert(c, timer);
+	if(w < c->armed) tru_timer_program(c);  // Only when it is the new nearest event
+
+	tru_timer_irq_restore(flags);
+}
+
+// Starts or restarts a timer to expire delay global timer ticks from now
+void tru_timer_start(tru_timer_t *timer, uint64_t delay, uint64_t period){
+	tru_timer_start_at(timer, gtim_get_counter() + delay, period);
+}
+
+/*
+	Stops a timer.  The comparator is left armed, an IRQ with nothing to do
+	is cheaper than finding the next event here.
+	Returns true if the timer was pending.
+*/
+bool tru_timer_cancel(tru_timer_t *timer){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+	uint32_t flags = tru_timer_irq_save();
+	bool pending = timer->pprev != NULL;
+
+	if(pending) tru_timer_unlink(c, timer);
+	tru_timer_irq_restore(flags);
+
+	return pending;
+}
+
+void tru_timer_get_stats(uint32_t cpu, tru_timer_stats_t *stats){
+	uint32_t flags = tru_timer_irq_save();
+
+	*stats = tru_timer_cpus[cpu].stats;
+	tru_timer_irq_restore(flags);
+}
+
+// Resets the statistics of the calling CPU
+void tru_timer_reset_stats(void){
+	tru_timer_cpu_t *c = &tru_timer_cpus[tru_cpu_id()];
+	uint32_t flags = tru_timer_irq_save();
+
+	c->stats.irqs = 0U;
+	c->stats.expired = 0U;
+	c->stats.cascaded = 0U;
+	c->stats.dropped = 0U;
+	c->stats.isr_max = 0U;
+	c->stats.isr_sum = 0U;
+	tru_timer_irq_restore(flags);
+}
+
+#endif
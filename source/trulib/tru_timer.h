@@ -0,0 +1,133 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Software timers on a hierarchical timing wheel, driven by the global
+	timer comparator.
+
+	Each CPU has its own wheel of 4 levels with 64 slots each.  Level 0
+	slots are one wheel tick (1 << TRU_TIMER_RES_SHIFT global timer ticks)
+	apart, each level above is 64 times coarser.  A timer goes into the
+	level its remaining time fits in, a linked list insert and a bitmap bit,
+	so starting and cancelling are O(1) whatever the number of timers.  When
+	the wheel reaches a slot of an upper level, its timers cascade down to
+	the finer levels, so every timer expires on its own wheel tick.  Timers
+	further away than the top level (2^24 wheel ticks) wait in the top level
+	and cascade again.
+
+	Tickless: there is no periodic tick.  The comparator (banked per CPU) is
+	armed for the nearest wheel tick that has something to do, an expiry or
+	a cascade, found from the slot bitmaps.  A timer never fires early, it is
+	rounded up to the next wheel tick.
+
+	Callbacks run in the comparator IRQ handler, or with TRU_TIMER_DEFER
+	from the deferred work queue of the CPU (tru_defer.h, which must be
+	initialised).  A periodic timer is restarted before its callback runs,
+	so the callback can cancel it.  If the callbacks fall behind by more
+	than a period, the missed periods are skipped.
+
+	Usage:
+		tru_timer_cpu_init();
+		tru_timer_init(&t, led_blink, NULL, 0U);
+		tru_timer_start(&t, tru_time_ms_to_ticks(1U), tru_time_ms_to_ticks(500U));  // First after 1 ms, then every 500 ms
+
+	Notes:
+		- A timer belongs to the CPU that started it, start and cancel it on
+		  that CPU only.  Callable from IRQ handlers and callbacks
+		- A deferred callback that is already posted may still run after
+		  tru_timer_cancel()
+		- tru_timer_cpu_exit() drops the timers still pending on the CPU
+		- tru_timer owns the global timer comparator and its IRQ on the CPUs
+		  that call tru_timer_cpu_init(), tru_co and tru_thread cannot run
+		  there
+*/
+
+#ifndef TRU_TIMER_H
+#define TRU_TIMER_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+#include "arm/tru_cortex_a9.h"
+#include "tru_time.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define TRU_TIMER_CPUS       2U
+#define TRU_TIMER_LEVELS     4U
+#define TRU_TIMER_SLOT_BITS  6U
+#define TRU_TIMER_SLOTS      (1U << TRU_TIMER_SLOT_BITS)
+#define TRU_TIMER_RES_SHIFT  8U   // Wheel tick = 256 global timer ticks, 1.28 us at 800 MHz
+#define TRU_TIMER_GTIM_IRQ   VirtualTimer_IRQn  // Cortex-A9 global timer PPI
+#define TRU_TIMER_PRIORITY   0xE0U  // Above the deferred work SGI
+
+// Flags
+#define TRU_TIMER_DEFER 0x1U  // Run the callback from tru_defer at TRU_DEFER_NORMAL instead of the IRQ handler
+
+typedef struct tru_timer tru_timer_t;
+typedef void (*tru_timer_fn_t)(tru_timer_t *timer, void *ctx);
+
+struct tru_timer{
+	tru_timer_t *next;    // Slot list
+	tru_timer_t **pprev;  // NULL = not pending
+	uint64_t expires;     // Global timer count
+	uint64_t period;      // 0 = one-shot
+	uint64_t fired;       // Expiry of the last run, for the callback
+	tru_timer_fn_t fn;
+	void *ctx;
+	uint8_t level;
+	uint8_t slot;
+	uint8_t flags;
+};
+
+typedef struct{
+	uint32_t irqs;        // Comparator IRQs
+	uint32_t expired;     // Callbacks run or posted
+	uint32_t cascaded;    // Timers moved down a level
+	uint32_t dropped;     // Deferred callbacks lost to a full tru_defer queue
+	uint32_t isr_max;     // Longest IRQ handler, global timer ticks
+	uint64_t isr_sum;
+}tru_timer_stats_t;
+
+void tru_timer_cpu_init(void);
+void tru_timer_cpu_exit(void);
+void tru_timer_init(tru_timer_t *timer, tru_timer_fn_t fn, void *ctx, uint32_t flags);
+void tru_timer_start(tru_timer_t *timer, uint64_t delay, uint64_t period);
+void tru_timer_start_at(tru_timer_t *timer, uint64_t expires, uint64_t period);
+bool tru_timer_cancel(tru_timer_t *timer);
+void tru_timer_get_stats(uint32_t cpu, tru_timer_stats_t *stats);
+void tru_timer_reset_stats(void);
+
+// Returns true if the timer is started and has not expired yet (or is periodic)
+static inline bool tru_timer_is_pending(const tru_timer_t *timer){
+	return timer->pprev != NULL;
+}
+
+#endif
+
+#endif